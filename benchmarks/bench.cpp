@@ -0,0 +1,216 @@
+/// @file bench.cpp
+/// @brief Microbenchmarks of parsing, of the arguments, and of the lookups.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "bench_common.hpp"
+
+#include <interpreter/argument.hpp>
+#include <interpreter/command_table.hpp>
+#include <interpreter/interpreter.hpp>
+#include <interpreter/keyword_index.hpp>
+#include <interpreter/keyword_table.hpp>
+#include <interpreter/parse_cache.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/// Short commands, as typed most of the time.
+static const std::vector<std::string> short_lines = {
+    "look", "north", "take pen", "take 2*pen from 3.box", "put all.coin in the bag", "give 10*gold to guard",
+};
+
+/// Long `say` lines.
+static const std::vector<std::string> say_lines = {
+    "say two quantities are in the golden ratio if their ratio is the same as the ratio of their sum to the larger "
+    "of the two quantities",
+    "say has anyone seen the blacksmith? I need to repair my sword before we go back to the caves in the north",
+    "say the 3rd floor of the tower is full of traps, so watch your step and do not touch any of the levers",
+};
+
+/// Lines with many arguments.
+static const std::vector<std::string> many_lines = {
+    "put 2*sword 3*shield 4.helmet all.coin 5*arrow the bow and the 2.quiver in the big 3.chest at the end of the "
+    "hall",
+    "take the red pen and the blue pen and the 2.green pen from the 3.box on the table in the 2.room",
+};
+
+/// @brief Cycles through the lines of a corpus.
+class Corpus
+{
+private:
+    /// The lines.
+    const std::vector<std::string> &lines;
+    /// The next line.
+    std::size_t next;
+
+public:
+    /// @brief Constructor.
+    /// @param _lines the lines.
+    explicit Corpus(const std::vector<std::string> &_lines)
+        : lines(_lines)
+        , next(0)
+    {
+        // Nothing to do.
+    }
+
+    /// @brief Provides the next line.
+    /// @return the line.
+    auto operator()() -> const char *
+    {
+        const char *line = lines[next].c_str();
+        next             = (next + 1) % lines.size();
+        return line;
+    }
+};
+
+int main(int argc, char **argv)
+{
+    bench::Runner runner(argc, argv);
+    interpreter::Interpreter args;
+
+    // Parsing.
+    for (bool ignore : {false, true}) {
+        const std::string suffix = ignore ? "/ignore" : "/no_ignore";
+        Corpus short_corpus(short_lines);
+        runner.run("parse/short" + suffix, [&]() {
+            args.parse(short_corpus(), ignore);
+            bench::do_not_optimize(args.size());
+        });
+        Corpus say_corpus(say_lines);
+        runner.run("parse/say" + suffix, [&]() {
+            args.parse(say_corpus(), ignore);
+            bench::do_not_optimize(args.size());
+        });
+        Corpus many_corpus(many_lines);
+        runner.run("parse/many_args" + suffix, [&]() {
+            args.parse(many_corpus(), ignore);
+            bench::do_not_optimize(args.size());
+        });
+    }
+
+    // Parsing only the name of free-text commands.
+    Corpus raw_corpus(say_lines);
+    runner.run("parse/say/limit_1", [&]() {
+        args.parse(raw_corpus(), false, 1);
+        bench::do_not_optimize(args.get_rest().data());
+    });
+
+    // Parsing repeated lines through the cache.
+    interpreter::ParseCache cache;
+    Corpus cached_short(short_lines);
+    runner.run("parse/short/cached", [&]() {
+        cache.parse(args, cached_short(), true);
+        bench::do_not_optimize(args.size());
+    });
+    Corpus cached_many(many_lines);
+    runner.run("parse/many_args/cached", [&]() {
+        cache.parse(args, cached_many(), true);
+        bench::do_not_optimize(args.size());
+    });
+
+    // Building the arguments.
+    for (const char *word : {"pen", "2.pen", "3*pen", "all.pen"}) {
+        std::string text(word);
+        runner.run(std::string("argument/") + word, [&]() {
+            interpreter::Argument argument(text);
+            bench::do_not_optimize(argument.get_index() + argument.get_quantity());
+        });
+    }
+
+    // Looking up the parsed arguments.
+    args.parse(many_lines[0].c_str(), false);
+    const std::string exact("chest"), prefix("hel");
+    runner.run("find/exact", [&]() { bench::do_not_optimize(args.find(exact, true)); });
+    runner.run("find/prefix", [&]() { bench::do_not_optimize(args.find(prefix, false)); });
+    runner.run("substr/1", [&]() {
+        std::string text = args.substr(1);
+        bench::do_not_optimize(text.data());
+    });
+
+    runner.run("substr_view/1", [&]() { bench::do_not_optimize(args.substr_view(1).data()); });
+
+    Corpus remove_corpus(many_lines);
+    runner.run("remove_ignored_words/many_args", [&]() {
+        args.parse(remove_corpus(), false);
+        args.remove_ignored_words();
+        bench::do_not_optimize(args.size());
+    });
+
+    // Mapping the arguments to options.
+    static constexpr interpreter::OptionName option_names[] = {
+        {1, "name"}, {2, "address"}, {3, "description"}, {4, "password"}, {5, "prompt"}, {6, "color"},
+    };
+    static const interpreter::OptionSet options(option_names, 3);
+    const std::vector<interpreter::Option> option_list = {
+        {1, {"name"}}, {2, {"address"}}, {3, {"description"}}, {4, {"password"}}, {5, {"prompt"}}, {6, {"color"}},
+    };
+    interpreter::Argument option_argument(std::string("promp"));
+    runner.run("map_to_option/option_set", [&]() {
+        bench::do_not_optimize(option_argument.map_to_option(options));
+    });
+    runner.run("map_to_option/predicate", [&]() {
+        bench::do_not_optimize(
+            option_argument.map_to_option(option_list, [](const std::string &content, const std::string &name) {
+                return ustr::is_abbreviation_of(content, name, false, 3);
+            }));
+    });
+
+    // Matching abbreviations.
+    const std::string full("inventory");
+    interpreter::Argument abbreviation(std::string("inv"));
+    runner.run("abbreviation/argument", [&]() { bench::do_not_optimize(abbreviation.is_abbreviation_of(full)); });
+    interpreter::CommandTable commands;
+    for (const char *name : {"look", "north", "south", "east", "west", "take", "put", "give", "say", "inventory",
+                             "configure", "quit", "score", "equipment", "kill", "flee"}) {
+        commands.add(name, nullptr, 2);
+    }
+    runner.run("abbreviation/command_table", [&]() { bench::do_not_optimize(commands.find("inv")); });
+
+    // Resolving an argument against a crowded room.
+    static const char *const adjectives[] = {"red", "rusty", "golden", "small", "heavy", "old", "shiny", "broken"};
+    static const char *const nouns[]      = {"sword", "shield", "coin", "pen", "box", "key", "ring", "helmet", "boots"};
+    std::vector<std::vector<std::string>> room(10000);
+    interpreter::KeywordIndex keywords;
+    for (std::uint32_t object = 0; object < room.size(); ++object) {
+        room[object] = {adjectives[object % 8], nouns[(object / 8) % 9]};
+        for (const auto &keyword : room[object]) {
+            keywords.insert(keyword, object);
+        }
+    }
+    interpreter::Argument target(std::string("100.sw"));
+    std::vector<std::uint32_t> found;
+    runner.run("keyword/index/10k", [&]() { bench::do_not_optimize(keywords.find(target, found)); });
+    runner.run("keyword/linear/10k", [&]() {
+        std::size_t seen = 0;
+        for (std::uint32_t object = 0; object < room.size(); ++object) {
+            bool match = std::any_of(room[object].begin(), room[object].end(), [&target](const std::string &keyword) {
+                return target.is_abbreviation_of(keyword);
+            });
+            if (match && (++seen == target.get_index())) {
+                bench::do_not_optimize(object);
+                break;
+            }
+        }
+    });
+
+    // Matching an abbreviation against every keyword of the room.
+    std::vector<std::string> room_keywords;
+    for (const auto &object : room) {
+        room_keywords.insert(room_keywords.end(), object.begin(), object.end());
+    }
+    interpreter::KeywordTable table(room_keywords);
+    interpreter::Argument abbreviated(std::string("sw"));
+    runner.run("keyword/table/20k", [&]() { bench::do_not_optimize(table.match(abbreviated, found)); });
+    runner.run("keyword/each/20k", [&]() {
+        found.clear();
+        for (std::uint32_t position = 0; position < room_keywords.size(); ++position) {
+            if (abbreviated.is_abbreviation_of(room_keywords[position])) {
+                found.push_back(position);
+            }
+        }
+        bench::do_not_optimize(found.size());
+    });
+
+    return 0;
+}
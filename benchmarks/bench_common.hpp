@@ -0,0 +1,126 @@
+/// @file bench_common.hpp
+/// @brief Common setup for all benchmarks: the runner, and the allocation counters.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+///
+/// @details It replaces the global operator new and delete, so it must be
+/// included by a single translation unit of each benchmark executable.
+
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace bench
+{
+
+/// The number of global allocations performed so far.
+inline std::size_t allocations = 0;
+/// The number of bytes allocated so far.
+inline std::size_t bytes = 0;
+
+/// @brief Prevents the compiler from optimizing away a value.
+/// @param value the value.
+template <typename T>
+inline void do_not_optimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+/// @brief Runs the benchmarks, and prints their results.
+///
+/// @details Every benchmark is repeated until it runs for at least the
+/// minimum time, and reports the time, the allocations and the bytes
+/// allocated per operation. The options are `--filter=<text>`, which only
+/// runs the benchmarks containing the text, and `--min-time=<seconds>`.
+class Runner
+{
+private:
+    /// Only the benchmarks containing this text are run.
+    std::string filter;
+    /// The minimum time of each benchmark, in seconds.
+    double min_time;
+
+public:
+    /// @brief Constructor.
+    /// @param argc the number of arguments.
+    /// @param argv the arguments.
+    Runner(int argc, char **argv)
+        : filter()
+        , min_time(0.25)
+    {
+        for (int it = 1; it < argc; ++it) {
+            if (std::strncmp(argv[it], "--filter=", 9) == 0) {
+                filter = argv[it] + 9;
+            } else if (std::strncmp(argv[it], "--min-time=", 11) == 0) {
+                min_time = std::strtod(argv[it] + 11, nullptr);
+            }
+        }
+        std::cout << std::left << std::setw(40) << "Benchmark" << std::right << std::setw(14) << "ns/op"
+                  << std::setw(12) << "allocs/op" << std::setw(12) << "bytes/op" << std::setw(14) << "iterations"
+                  << "\n"
+                  << std::string(92, '-') << "\n";
+    }
+
+    /// @brief Runs a benchmark.
+    /// @param name the name of the benchmark.
+    /// @param operation the operation, which is measured.
+    template <typename Fun>
+    void run(const std::string &name, Fun operation)
+    {
+        if (!filter.empty() && (name.find(filter) == std::string::npos)) {
+            return;
+        }
+        // Warm up the caches, and the buffers of the operation.
+        operation();
+        std::size_t iterations = 1;
+        while (true) {
+            std::size_t allocations_before = allocations;
+            std::size_t bytes_before       = bytes;
+            auto start                     = std::chrono::steady_clock::now();
+            for (std::size_t it = 0; it < iterations; ++it) {
+                operation();
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if ((elapsed.count() >= min_time) || (iterations >= 1000000000)) {
+                auto count = static_cast<double>(iterations);
+                std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1)
+                          << std::setw(14) << (elapsed.count() * 1e9 / count) << std::setprecision(2)
+                          << std::setw(12) << (static_cast<double>(allocations - allocations_before) / count)
+                          << std::setprecision(1) << std::setw(12)
+                          << (static_cast<double>(bytes - bytes_before) / count) << std::setw(14) << iterations
+                          << "\n";
+                return;
+            }
+            // Aim past the minimum time, without growing too fast on noisy short runs.
+            double target = (elapsed.count() > 0) ? (min_time * 1.4 / elapsed.count()) : 100.0;
+            iterations    = static_cast<std::size_t>(static_cast<double>(iterations) * std::min(100.0, std::max(2.0, target)));
+        }
+    }
+};
+
+} // namespace bench
+
+void *operator new(std::size_t size)
+{
+    ++bench::allocations;
+    bench::bytes += size;
+    if (void *p = std::malloc(size != 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
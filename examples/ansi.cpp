@@ -0,0 +1,46 @@
+/// @file ansi.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the ANSI escape codes used by the examples.
+
+#include "ansi.hpp"
+
+const char *ansi::fg::black   = "\33[30m";
+const char *ansi::fg::red     = "\33[31m";
+const char *ansi::fg::green   = "\33[32m";
+const char *ansi::fg::yellow  = "\33[33m";
+const char *ansi::fg::blue    = "\33[34m";
+const char *ansi::fg::magenta = "\33[35m";
+const char *ansi::fg::cyan    = "\33[36m";
+const char *ansi::fg::white   = "\33[37m";
+
+const char *ansi::fg::bright_black   = "\33[30;1m";
+const char *ansi::fg::bright_red     = "\33[31;1m";
+const char *ansi::fg::bright_green   = "\33[32;1m";
+const char *ansi::fg::bright_yellow  = "\33[33;1m";
+const char *ansi::fg::bright_blue    = "\33[34;1m";
+const char *ansi::fg::bright_magenta = "\33[35;1m";
+const char *ansi::fg::bright_cyan    = "\33[36;1m";
+const char *ansi::fg::bright_white   = "\33[37;1m";
+
+const char *ansi::bg::black   = "\33[40m";
+const char *ansi::bg::red     = "\33[41m";
+const char *ansi::bg::green   = "\33[42m";
+const char *ansi::bg::yellow  = "\33[43m";
+const char *ansi::bg::blue    = "\33[44m";
+const char *ansi::bg::magenta = "\33[45m";
+const char *ansi::bg::cyan    = "\33[46m";
+const char *ansi::bg::white   = "\33[47m";
+
+const char *ansi::util::reset     = "\33[0m";
+const char *ansi::util::bold      = "\33[1m";
+const char *ansi::util::italic    = "\33[3m";
+const char *ansi::util::underline = "\33[4m";
+const char *ansi::util::reverse   = "\33[7m";
+const char *ansi::util::clear     = "\33[2J";
+const char *ansi::util::clearline = "\33[2K";
+const char *ansi::util::up        = "\33[1A";
+const char *ansi::util::down      = "\33[1B";
+const char *ansi::util::right     = "\33[1C";
+const char *ansi::util::left      = "\33[1D";
+const char *ansi::util::nextline  = "\33[1E";
+const char *ansi::util::prevline  = "\33[1F";
@@ -0,0 +1,191 @@
+/// @file commands.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief The commands shared by the examples.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <interpreter/argument.hpp>
+#include <interpreter/command_table.hpp>
+#include <interpreter/interpreter.hpp>
+
+#include "ansi.hpp"
+
+/// @brief Where the commands write their messages, e.g., the buffer of a session.
+inline thread_local std::ostream *output = &std::cout;
+/// @brief Where the commands write their errors.
+inline thread_local std::ostream *errors = &std::cerr;
+
+inline bool do_say(interpreter::Interpreter &args)
+{
+    // The message is kept as it was typed, see the registration of `say`.
+    std::string message(args.get_rest());
+    if (ustr::end_with(message, "?", false, 0)) {
+        *output << "You ask '" << ansi::fg::yellow;
+    } else {
+        *output << "You say '" << ansi::fg::cyan;
+    }
+    *output << ansi::util::italic << message << ansi::util::reset << "'\n";
+    return true;
+}
+
+inline bool do_look(interpreter::Interpreter &args)
+{
+    // Remove ignored words.
+    args.remove_ignored_words();
+
+    // Error checking.
+    if (args[0].has_prefix_all() || args[0].has_quantity()) {
+        *errors << ansi::fg::red << "[Arg. 1] You cannot specify a quantity.\n" << ansi::util::reset;
+        return false;
+    }
+    // Error checking (it is safe even if the container is not provided).
+    if (args[1].has_prefix_all() || args[1].has_quantity()) {
+        *errors << ansi::fg::red << "[Arg. 2] You cannot specify a quantity.\n" << ansi::util::reset;
+        return false;
+    }
+
+    // The object.
+    *output << "You look";
+    if (args[0].has_index()) {
+        std::size_t index = args[0].get_index();
+        *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+    }
+    *output << " " << ansi::fg::green << args[0] << ansi::util::reset << " ";
+
+    // The container (if provided).
+    if (args.size() == 2) {
+        *output << "in";
+        if (args[1].has_index()) {
+            std::size_t index = args[1].get_index();
+            *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+        }
+        *output << " " << ansi::fg::green << args[1] << ansi::util::reset << " ";
+    }
+    *output << "\n";
+    return true;
+}
+
+inline bool do_take(interpreter::Interpreter &args)
+{
+    // Remove ignored words.
+    args.remove_ignored_words();
+
+    // Error checking.
+    if (!args[0].has_only_one_prefix()) {
+        *errors << ansi::fg::red << "[Arg. 1] You cannot specify both quantity and index.\n" << ansi::util::reset;
+        return false;
+    }
+    if ((args.size() == 2) && (!args[1].has_only_one_prefix())) {
+        *errors << ansi::fg::red << "[Arg. 2] You cannot specify both quantity and index.\n" << ansi::util::reset;
+        return false;
+    }
+
+    // The object.
+    *output << "You take";
+    if (args[0].has_prefix_all()) {
+        *output << " " << ansi::fg::magenta << "all" << ansi::util::reset;
+    } else if (args[0].has_quantity()) {
+        *output << " " << ansi::fg::magenta << args[0].get_quantity() << ansi::util::reset << " per";
+    } else if (args[0].has_index()) {
+        std::size_t index = args[0].get_index();
+        *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+    }
+    *output << " " << ansi::fg::green << args[0] << ansi::util::reset << " ";
+
+    // The container (if provided).
+    if (args.size() == 2) {
+        *output << "from";
+        if (args[1].has_index()) {
+            std::size_t index = args[1].get_index();
+            *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+        }
+        *output << " " << ansi::fg::green << args[1] << ansi::util::reset << " ";
+    }
+    *output << "\n";
+    return true;
+}
+
+inline bool do_put(interpreter::Interpreter &args)
+{
+    // Remove ignored words.
+    args.remove_ignored_words();
+
+    // Check if the user provided the container.
+    if (args.size() != 2) {
+        *errors << ansi::fg::red << "You must provide the container.\n" << ansi::util::reset;
+        return false;
+    }
+    // Error checking.
+    if (args[1].has_prefix_all() || args[1].has_quantity()) {
+        *errors << ansi::fg::red << "[Arg. 2] You cannot specify a quantity.\n" << ansi::util::reset;
+        return false;
+    }
+
+    // Run the command.
+    *output << "You put";
+    if (args[0].has_prefix_all()) {
+        *output << " " << ansi::fg::magenta << "all" << ansi::util::reset;
+    } else if (args[0].has_quantity()) {
+        *output << " " << ansi::fg::magenta << args[0].get_quantity() << ansi::util::reset << " per";
+    } else if (args[0].has_index()) {
+        std::size_t index = args[0].get_index();
+        *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+    }
+    *output << " " << ansi::fg::green << args[0] << ansi::util::reset << " ";
+
+    // Container.
+    *output << "in";
+    if (args[1].has_index()) {
+        std::size_t index = args[1].get_index();
+        *output << " the " << ansi::fg::magenta << index << ustr::get_ordinal(index) << ansi::util::reset;
+    }
+    *output << " " << ansi::fg::green << args[1] << ansi::util::reset << " ";
+    *output << "\n";
+    return true;
+}
+
+inline bool do_configure(interpreter::Interpreter &args)
+{
+    // Set the list of options.
+    enum option_type_t {
+        option_type_none,
+        option_type_name,
+        option_type_address,
+    };
+    // The options are compiled once, and accept abbreviations of at least 3 characters.
+    static constexpr interpreter::OptionName option_names[] = {
+        {option_type_name, "name"},
+        {option_type_address, "address"},
+    };
+    static const interpreter::OptionSet options(option_names, 3);
+    unsigned option = args[0].map_to_option(options);
+
+    if (option == option_type_name) {
+        *output << "You selected " << ansi::fg::magenta << "name" << ansi::util::reset;
+    } else if (option == option_type_address) {
+        *output << "You selected " << ansi::fg::magenta << "address" << ansi::util::reset;
+    } else {
+        *output << ansi::fg::red << "Selection is not valid" << ansi::util::reset;
+    }
+    return false;
+}
+
+inline bool handle_input(interpreter::Interpreter &args, std::string_view input)
+{
+    // The table of commands, built once.
+    static const interpreter::CommandTable commands = []() {
+        interpreter::CommandTable table;
+        // Say does not need any argument, only the rest of the line.
+        table.add("say", do_say, std::string::npos, 0, 0);
+        table.add("look", do_look);
+        table.add("take", do_take);
+        table.add("put", do_put);
+        table.add("configure", do_configure, 3);
+        return table;
+    }();
+    // Parse the input, as far as the command needs, and handle it.
+    return commands.dispatch(args, input, false);
+}
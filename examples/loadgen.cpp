@@ -0,0 +1,205 @@
+/// @file loadgen.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Replays a mix of commands against the example server, and measures their latency.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief A connection to the server.
+struct Connection {
+    int fd;                               ///< The socket.
+    std::deque<Clock::time_point> sent;   ///< When the commands waiting for an answer were due.
+    std::string pending;                  ///< The bytes which could not be sent yet.
+    bool newline = false;                 ///< If the last byte received was a newline.
+};
+
+/// @brief The mix of commands, the frequent ones appear more than once, the last ones are unknown to the server.
+static const char *mix[] = {
+    "look",
+    "look sword",
+    "look 2.sword chest",
+    "say hello everyone",
+    "say is anyone there?",
+    "take sword",
+    "take all.coin",
+    "take 3*coin chest",
+    "put sword chest",
+    "look the sword in the chest",
+    "take sword",
+    "look",
+    "kill rat",
+    "north",
+};
+
+/// @brief Sends as much of the pending commands as the socket accepts.
+/// @param connection the connection.
+/// @return false if the connection was lost.
+static inline bool flush(Connection &connection)
+{
+    while (!connection.pending.empty()) {
+        ssize_t count = send(connection.fd, connection.pending.data(), connection.pending.size(), MSG_NOSIGNAL);
+        if (count < 0) {
+            return (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR);
+        }
+        connection.pending.erase(0, static_cast<std::size_t>(count));
+    }
+    return true;
+}
+
+/// @brief Provides a percentile of the sorted latencies.
+/// @param latencies the sorted latencies, in nanoseconds.
+/// @param percentile the percentile, between 0 and 1.
+/// @return the latency, in microseconds.
+static inline double percentile_of(const std::vector<std::int64_t> &latencies, double percentile)
+{
+    if (latencies.empty()) {
+        return 0.0;
+    }
+    auto position = static_cast<std::size_t>(percentile * static_cast<double>(latencies.size() - 1));
+    return static_cast<double>(latencies[position]) / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+    auto port     = static_cast<std::uint16_t>((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 4000);
+    auto sessions = static_cast<std::size_t>((argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1000);
+    double rate   = (argc > 3) ? std::strtod(argv[3], nullptr) : 20000.0;
+    double length = (argc > 4) ? std::strtod(argv[4], nullptr) : 10.0;
+    if ((sessions == 0) || (rate <= 0.0) || (length <= 0.0)) {
+        std::cerr << "Usage: " << argv[0] << " [port] [sessions] [commands per second] [seconds]\n";
+        return 1;
+    }
+
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    int poller = epoll_create1(0);
+    if (poller < 0) {
+        std::cerr << "Cannot create the epoll instance: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    std::vector<Connection> connections(sessions);
+    for (std::size_t it = 0; it < sessions; ++it) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if ((fd < 0) || (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)) {
+            std::cerr << "Cannot open session " << it << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+        int enable = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        // Switch to non-blocking only after connecting, so that the connection is ready.
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        connections[it].fd = fd;
+        epoll_event event{};
+        event.events   = EPOLLIN | EPOLLOUT | EPOLLET;
+        event.data.u64 = it;
+        if (epoll_ctl(poller, EPOLL_CTL_ADD, fd, &event) < 0) {
+            std::cerr << "Cannot watch session " << it << ": " << std::strerror(errno) << "\n";
+            return 1;
+        }
+    }
+
+    // The commands are sent on a fixed schedule, whatever the server does, and
+    // their latency is measured from when they were due, not from when they
+    // were actually sent, so that a slow server cannot hide its own delays.
+    const auto total    = static_cast<std::size_t>(rate * length);
+    const auto interval = std::chrono::duration<double, std::nano>(1e9 / rate);
+    const std::size_t commands = sizeof(mix) / sizeof(mix[0]);
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(total);
+    std::vector<epoll_event> events(1024);
+    std::vector<char> buffer(65536);
+    std::size_t next = 0, waiting = 0;
+    const Clock::time_point start    = Clock::now();
+    const Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(interval * total) +
+                                       std::chrono::seconds(5);
+    Clock::time_point last = start;
+    while (((next < total) || (waiting > 0)) && (Clock::now() < deadline)) {
+        // Send the commands which are due.
+        Clock::time_point now = Clock::now();
+        while (next < total) {
+            Clock::time_point due = start + std::chrono::duration_cast<Clock::duration>(interval * next);
+            if (due > now) {
+                break;
+            }
+            Connection &connection = connections[next % sessions];
+            connection.sent.push_back(due);
+            connection.pending.append(mix[next % commands]).push_back('\n');
+            flush(connection);
+            ++next;
+            ++waiting;
+        }
+        int ready = epoll_wait(poller, events.data(), static_cast<int>(events.size()), 1);
+        for (int it = 0; it < ready; ++it) {
+            const epoll_event &current = events[static_cast<std::size_t>(it)];
+            Connection &connection     = connections[current.data.u64];
+            if ((current.events & EPOLLOUT) != 0) {
+                flush(connection);
+            }
+            if ((current.events & EPOLLIN) == 0) {
+                continue;
+            }
+            ssize_t count;
+            while ((count = read(connection.fd, buffer.data(), buffer.size())) > 0) {
+                Clock::time_point received = Clock::now();
+                for (ssize_t position = 0; position < count; ++position) {
+                    char c = buffer[static_cast<std::size_t>(position)];
+                    // Each answer ends with the prompt, i.e., "\n> ".
+                    if (connection.newline && (c == '>') && !connection.sent.empty()) {
+                        latencies.push_back(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(received - connection.sent.front())
+                                .count());
+                        connection.sent.pop_front();
+                        --waiting;
+                        last = received;
+                    }
+                    connection.newline = (c == '\n');
+                }
+            }
+        }
+    }
+
+    for (const Connection &connection : connections) {
+        close(connection.fd);
+    }
+    close(poller);
+
+    std::sort(latencies.begin(), latencies.end());
+    double elapsed = std::chrono::duration<double>(last - start).count();
+    std::cout << "Sessions   : " << sessions << "\n";
+    std::cout << "Commands   : " << latencies.size() << " answered, " << waiting << " unanswered\n";
+    std::cout << "Throughput : " << ((elapsed > 0.0) ? static_cast<double>(latencies.size()) / elapsed : 0.0)
+              << " commands/s (target " << rate << ")\n";
+    std::cout << "Latency    : p50 " << percentile_of(latencies, 0.50) << " us, p99 " << percentile_of(latencies, 0.99)
+              << " us, p999 " << percentile_of(latencies, 0.999) << " us, max "
+              << percentile_of(latencies, 1.0) << " us\n";
+    return 0;
+}
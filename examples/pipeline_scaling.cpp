@@ -0,0 +1,55 @@
+/// @file pipeline_scaling.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Measures how the parsing pipeline scales with the number of workers.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <interpreter/pipeline.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+int main(int argc, char **argv)
+{
+    // The number of sessions sending a line every tick, the number of ticks, and the most workers to try.
+    std::size_t sessions = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    std::size_t ticks    = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 50;
+    std::size_t cores    = (argc > 3) ? std::strtoul(argv[3], nullptr, 10)
+                                      : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    const std::vector<std::string> commands = {
+        "take 2*pen from 3.box",
+        "look",
+        "put all.coin in the bag",
+        "say two quantities are in the golden ratio if their ratio is the same as the ratio of their sum",
+        "give 10*gold to the 2.guard",
+        "north"};
+    std::vector<std::string> lines;
+    for (std::size_t it = 0; it < sessions; ++it) {
+        lines.push_back(commands[it % commands.size()]);
+    }
+
+    std::cout << "sessions: " << sessions << ", ticks: " << ticks << ", cores: " << cores << "\n";
+    std::cout << std::setw(8) << "workers" << std::setw(16) << "lines/s" << std::setw(12) << "speedup" << "\n";
+    double baseline = 0;
+    for (std::size_t workers = 1; workers <= cores; ++workers) {
+        interpreter::Pipeline pipeline(workers);
+        std::vector<interpreter::Interpreter> results;
+        // Warm up the interpreters, so that we do not measure their first allocations.
+        pipeline.parse(lines, true, results);
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t tick = 0; tick < ticks; ++tick) {
+            pipeline.parse(lines, true, results);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double rate = static_cast<double>(sessions * ticks) / elapsed.count();
+        if (workers == 1) {
+            baseline = rate;
+        }
+        std::cout << std::setw(8) << workers << std::setw(16) << static_cast<std::size_t>(rate) << std::setw(11)
+                  << std::setprecision(3) << (rate / baseline) << "x\n";
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+/// @file queue_contention.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Compares the command queue with a deque protected by a mutex, as the number of producers grows.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <interpreter/command_queue.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+/// @brief The lines sent by the sessions.
+static const std::vector<std::string> commands = {
+    "take 2*pen from 3.box",
+    "look",
+    "put all.coin in the bag",
+    "say two quantities are in the golden ratio if their ratio is the same as the ratio of their sum",
+    "give 10*gold to the 2.guard",
+    "north"};
+
+/// @brief The work done by the game loop on each command.
+/// @param args the command.
+/// @return something which depends on the command, so that the work is not optimized away.
+static inline std::size_t consume(const interpreter::Interpreter &args)
+{
+    return args.size() + (args[0].is_abbreviation_of("take") ? 1 : 0);
+}
+
+/// @brief Runs the producers and the consumer, with a deque of copies protected by a mutex.
+/// @param producers the number of producers.
+/// @param count the number of commands sent by each producer.
+/// @return the number of seconds.
+static inline double run_mutex(std::size_t producers, std::size_t count)
+{
+    std::mutex mutex;
+    std::deque<std::pair<std::uint32_t, interpreter::Interpreter>> queue;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&mutex, &queue, producer, count]() {
+            interpreter::Interpreter args;
+            for (std::size_t it = 0; it < count; ++it) {
+                args.parse(commands[it % commands.size()], false);
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.emplace_back(static_cast<std::uint32_t>(producer), args);
+            }
+        });
+    }
+    interpreter::Interpreter args;
+    std::size_t checksum = 0;
+    for (std::size_t received = 0; received < (producers * count);) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (queue.empty()) {
+                lock.unlock();
+                std::this_thread::yield();
+                continue;
+            }
+            args = queue.front().second;
+            queue.pop_front();
+        }
+        checksum += consume(args);
+        ++received;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() + static_cast<double>(checksum % 2) * 1e-12;
+}
+
+/// @brief Runs the producers and the consumer, with the command queue.
+/// @param producers the number of producers.
+/// @param count the number of commands sent by each producer.
+/// @param throttled where the number of commands refused to their session is stored.
+/// @return the number of seconds.
+static inline double run_queue(std::size_t producers, std::size_t count, std::size_t &throttled)
+{
+    // Every producer serves 64 sessions, and counts its refused commands on its own cache line.
+    interpreter::CommandQueue queue(4096, producers * 64, 8);
+    std::vector<std::size_t> refused(producers * 8, 0);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&queue, &refused, producer, count]() {
+            interpreter::Interpreter args;
+            for (std::size_t it = 0; it < count; ++it) {
+                args.parse(commands[it % commands.size()], false);
+                auto session = static_cast<std::uint32_t>((producer * 64) + (it % 64));
+                interpreter::CommandQueue::Result result;
+                while ((result = queue.push(session, args)) != interpreter::CommandQueue::Result::accepted) {
+                    if (result == interpreter::CommandQueue::Result::session_full) {
+                        ++refused[producer * 8];
+                    }
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    interpreter::Interpreter args;
+    std::uint32_t session = 0;
+    std::size_t checksum  = 0;
+    for (std::size_t received = 0; received < (producers * count);) {
+        if (!queue.pop(session, args)) {
+            std::this_thread::yield();
+            continue;
+        }
+        checksum += consume(args);
+        ++received;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    throttled                             = 0;
+    for (std::size_t producer = 0; producer < producers; ++producer) {
+        throttled += refused[producer * 8];
+    }
+    return elapsed.count() + static_cast<double>(checksum % 2) * 1e-12;
+}
+
+int main(int argc, char **argv)
+{
+    // The number of commands of each producer, and the most producers to try.
+    std::size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    std::size_t cores = (argc > 2) ? std::strtoul(argv[2], nullptr, 10)
+                                   : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    std::cout << "commands per producer: " << count << ", cores: " << cores << "\n";
+    std::cout << std::setw(10) << "producers" << std::setw(16) << "mutex/s" << std::setw(16) << "queue/s"
+              << std::setw(12) << "speedup" << std::setw(12) << "throttled" << "\n";
+    for (std::size_t producers = 1; producers <= std::max<std::size_t>(2, cores); ++producers) {
+        std::size_t throttled = 0;
+        double total          = static_cast<double>(producers * count);
+        double mutex_rate     = total / run_mutex(producers, count);
+        double queue_rate     = total / run_queue(producers, count, throttled);
+        std::cout << std::setw(10) << producers << std::setw(16) << static_cast<std::size_t>(mutex_rate)
+                  << std::setw(16) << static_cast<std::size_t>(queue_rate) << std::setw(11) << std::setprecision(3)
+                  << (queue_rate / mutex_rate) << "x" << std::setw(12) << throttled << "\n";
+    }
+    return 0;
+}
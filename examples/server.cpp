@@ -0,0 +1,214 @@
+/// @file server.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief A multi-session TCP server, which runs the commands of the examples for every session.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <interpreter/line_assembler.hpp>
+
+#include "commands.hpp"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// @brief A connected player.
+struct Session {
+    int fd;                            ///< The socket.
+    interpreter::LineAssembler input;  ///< The lines received.
+    interpreter::Interpreter args;     ///< The interpreter, reused for every command.
+    std::string pending;               ///< The bytes which could not be sent yet.
+    std::size_t sent = 0;              ///< The bytes of `pending` already sent.
+};
+
+/// @brief Set when the server must stop.
+static volatile std::sig_atomic_t stopping = 0;
+
+/// @brief Stops the server.
+static void stop(int) { stopping = 1; }
+
+/// @brief Raises the limit of open files as far as allowed, to accept thousands of sessions.
+static inline void raise_file_limit()
+{
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+/// @brief Sends as much of the pending output as the socket accepts.
+/// @param session the session.
+/// @return false if the connection was lost.
+static inline bool flush(Session &session)
+{
+    while (session.sent < session.pending.size()) {
+        ssize_t count = send(
+            session.fd, session.pending.data() + session.sent, session.pending.size() - session.sent, MSG_NOSIGNAL);
+        if (count < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                // The rest is sent when the socket becomes writable again.
+                return true;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        session.sent += static_cast<std::size_t>(count);
+    }
+    session.pending.clear();
+    session.sent = 0;
+    return true;
+}
+
+/// @brief Reads everything available, and runs the commands of the complete lines.
+/// @param session the session.
+/// @param buffer where the commands write their messages.
+/// @param commands incremented for every command.
+/// @return false if the connection was closed.
+static inline bool receive(Session &session, std::ostringstream &buffer, std::uint64_t &commands)
+{
+    // With edge-triggered notifications, the socket must be drained.
+    for (;;) {
+        char *destination = session.input.prepare();
+        std::size_t space = session.input.available();
+        ssize_t count     = (space > 0) ? read(session.fd, destination, space) : 0;
+        if (count < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                return true;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if ((count == 0) && (space > 0)) {
+            return false;
+        }
+        session.input.commit(static_cast<std::size_t>(count));
+        std::string_view line;
+        while (session.input.next_line(line)) {
+            buffer.str(std::string());
+            if (!handle_input(session.args, line)) {
+                buffer << "Huh?";
+            }
+            buffer << "\n> ";
+            session.pending.append(buffer.str());
+            ++commands;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    auto port = static_cast<std::uint16_t>((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 4000);
+
+    raise_file_limit();
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+
+    int listener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (listener < 0) {
+        std::cerr << "Cannot create the socket: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    int enable = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if ((bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) ||
+        (listen(listener, SOMAXCONN) < 0)) {
+        std::cerr << "Cannot listen on port " << port << ": " << std::strerror(errno) << "\n";
+        close(listener);
+        return 1;
+    }
+    int poller = epoll_create1(0);
+    if (poller < 0) {
+        std::cerr << "Cannot create the epoll instance: " << std::strerror(errno) << "\n";
+        close(listener);
+        return 1;
+    }
+    epoll_event event{};
+    event.events  = EPOLLIN | EPOLLET;
+    event.data.fd = listener;
+    if (epoll_ctl(poller, EPOLL_CTL_ADD, listener, &event) < 0) {
+        std::cerr << "Cannot watch the socket: " << std::strerror(errno) << "\n";
+        close(poller);
+        close(listener);
+        return 1;
+    }
+
+    // The sessions, by socket.
+    std::vector<std::unique_ptr<Session>> sessions;
+    std::size_t connected  = 0;
+    std::uint64_t commands = 0;
+    // The commands write inside a buffer, which is then queued to the session.
+    std::ostringstream buffer;
+    output = &buffer;
+    errors = &buffer;
+
+    std::cout << "Listening on 127.0.0.1:" << port << ", press Ctrl+C to stop.\n";
+    std::vector<epoll_event> events(1024);
+    while (stopping == 0) {
+        int ready = epoll_wait(poller, events.data(), static_cast<int>(events.size()), 1000);
+        for (int it = 0; it < ready; ++it) {
+            const epoll_event &current = events[static_cast<std::size_t>(it)];
+            if (current.data.fd == listener) {
+                // Accept all the pending connections.
+                int fd;
+                while ((fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK)) >= 0) {
+                    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                    epoll_event session_event{};
+                    session_event.events  = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+                    session_event.data.fd = fd;
+                    if (epoll_ctl(poller, EPOLL_CTL_ADD, fd, &session_event) < 0) {
+                        // We would never hear from it, so drop it at once.
+                        std::cerr << "Cannot watch a session: " << std::strerror(errno) << "\n";
+                        close(fd);
+                        continue;
+                    }
+                    if (sessions.size() <= static_cast<std::size_t>(fd)) {
+                        sessions.resize(static_cast<std::size_t>(fd) + 1);
+                    }
+                    sessions[static_cast<std::size_t>(fd)] = std::make_unique<Session>();
+                    sessions[static_cast<std::size_t>(fd)]->fd = fd;
+                    ++connected;
+                }
+                continue;
+            }
+            Session &session = *sessions[static_cast<std::size_t>(current.data.fd)];
+            bool alive       = (current.events & (EPOLLERR | EPOLLHUP)) == 0;
+            if (alive && ((current.events & (EPOLLIN | EPOLLRDHUP)) != 0)) {
+                alive = receive(session, buffer, commands);
+            }
+            // Send the answers, and whatever was left from before.
+            if (alive) {
+                alive = flush(session);
+            }
+            if (!alive) {
+                close(session.fd);
+                sessions[static_cast<std::size_t>(current.data.fd)].reset();
+                --connected;
+            }
+        }
+    }
+
+    std::cout << "\nHandled " << commands << " commands, " << connected << " sessions still connected.\n";
+    close(poller);
+    close(listener);
+    return 0;
+}
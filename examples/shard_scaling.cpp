@@ -0,0 +1,84 @@
+/// @file shard_scaling.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Measures how the sharded runtime scales with the number of shards.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <interpreter/sharded_runtime.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+
+/// @brief The input of a shard, kept on its own cache line.
+struct alignas(64) Input {
+    std::size_t next = 0; ///< The next command.
+};
+
+int main(int argc, char **argv)
+{
+    // The number of sessions, the seconds measured for each number of shards, and the most shards to try.
+    std::size_t sessions = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    double seconds       = (argc > 2) ? std::strtod(argv[2], nullptr) : 1.0;
+    std::size_t cores    = (argc > 3) ? std::strtoul(argv[3], nullptr, 10)
+                                      : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    // One command out of eight is a tell, to a session which is likely on another shard.
+    const std::vector<std::string> commands = {
+        "take 2*pen from 3.box",
+        "look",
+        "put all.coin in the bag",
+        "tell 7919 are you there?",
+        "give 10*gold to the 2.guard",
+        "north",
+        "look at the 2.guard",
+        "say hello everyone"};
+
+    std::cout << "sessions: " << sessions << ", seconds: " << seconds << ", cores: " << cores << "\n";
+    std::cout << std::setw(8) << "shards" << std::setw(16) << "commands/s" << std::setw(12) << "speedup"
+              << std::setw(16) << "messages/s" << "\n";
+    double baseline = 0;
+    for (std::size_t count = 1; count <= cores; ++count) {
+        std::vector<Input> inputs(count);
+        interpreter::ShardedRuntime runtime(
+            count,
+            [sessions](interpreter::ShardedRuntime::Shard &shard, std::uint32_t session, interpreter::Interpreter &args) {
+                if (args[0] == "tell") {
+                    auto target = static_cast<std::uint32_t>((session + std::stoul(args[1].get_content())) % sessions);
+                    shard.send(target, args.substr(2));
+                    return true;
+                }
+                return args[0].is_abbreviation_of("take") || args[0].is_abbreviation_of("look");
+            },
+            [](interpreter::ShardedRuntime::Shard &, std::uint32_t, std::string_view) {},
+            [&inputs, &commands, sessions, count](interpreter::ShardedRuntime::Shard &shard) {
+                // Every shard generates the input of its own sessions, as if it read them from its own sockets.
+                Input &input = inputs[shard.get_index()];
+                for (std::size_t it = 0; it < 64; ++it, ++input.next) {
+                    std::size_t session = (((input.next * count) + shard.get_index()) % sessions);
+                    shard.execute(static_cast<std::uint32_t>(session), commands[input.next % commands.size()]);
+                }
+                return true;
+            });
+        // Warm up the caches and the interpreters, so that we do not measure their first allocations.
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        std::uint64_t executed = runtime.get_executed();
+        std::uint64_t received = runtime.get_received();
+        auto start             = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        executed = runtime.get_executed() - executed;
+        received = runtime.get_received() - received;
+        runtime.stop();
+        double rate = static_cast<double>(executed) / elapsed.count();
+        if (count == 1) {
+            baseline = rate;
+        }
+        std::cout << std::setw(8) << count << std::setw(16) << static_cast<std::size_t>(rate) << std::setw(11)
+                  << std::setprecision(3) << (rate / baseline) << "x" << std::setw(16)
+                  << static_cast<std::size_t>(static_cast<double>(received) / elapsed.count()) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+/// @file arena.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a bump arena, and the allocator which uses it.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief A bump allocator, whose memory is released all at once.
+///
+/// @details Allocating from the arena only moves a pointer forward, and
+/// deallocating does nothing. When the current block is exhausted a new one is
+/// taken from the heap, and all the blocks are kept across calls to reset(), so
+/// that once the arena has grown to fit a whole tick of work it no longer
+/// allocates. Everything allocated from the arena must be released before
+/// calling reset(), i.e., the interpreters using it must be cleared.
+class Arena
+{
+private:
+    /// @brief A block of memory.
+    struct Block {
+        unsigned char *data; ///< The start of the block.
+        std::size_t size;    ///< The size of the block.
+        bool owned;          ///< If the block was allocated by the arena.
+    };
+
+    /// The list of blocks.
+    std::vector<Block> blocks;
+    /// The block we are currently allocating from.
+    std::size_t current;
+    /// The position of the first free byte inside the current block.
+    std::size_t offset;
+    /// The minimum size of the blocks allocated by the arena.
+    std::size_t block_size;
+    /// The number of bytes handed out since the last reset.
+    std::size_t used;
+
+public:
+    /// @brief Constructor.
+    /// @param _block_size the minimum size of the blocks taken from the heap.
+    explicit Arena(std::size_t _block_size = 4096);
+
+    /// @brief Constructor, which starts from a caller-provided buffer.
+    /// @param buffer the buffer, it must outlive the arena.
+    /// @param size the size of the buffer.
+    /// @param _block_size the minimum size of the blocks taken from the heap, once the buffer is exhausted.
+    Arena(void *buffer, std::size_t size, std::size_t _block_size = 4096);
+
+    /// @brief Copy constructor (deleted).
+    Arena(const Arena &) = delete;
+
+    /// @brief Copy assignment operator (deleted).
+    /// @return Reference to the instance.
+    auto operator=(const Arena &) -> Arena & = delete;
+
+    /// @brief Destructor.
+    ~Arena();
+
+    /// @brief Allocates the given amount of memory.
+    /// @param size the number of bytes.
+    /// @param alignment the required alignment, must be a power of two.
+    /// @return a pointer to the memory.
+    auto allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) -> void *;
+
+    /// @brief Releases all the memory at once, keeping the blocks for reuse.
+    void reset();
+
+    /// @brief Provides the number of bytes allocated since the last reset.
+    /// @return the number of bytes.
+    auto get_used() const -> std::size_t;
+
+    /// @brief Provides the total size of the blocks owned by the arena.
+    /// @return the number of bytes.
+    auto get_capacity() const -> std::size_t;
+};
+
+/// @brief Standard allocator which takes memory from an Arena.
+///
+/// @details When it is not bound to an arena, it falls back to the global heap,
+/// so that containers using it behave as usual. Copying a container gives a
+/// copy on the heap, since the copy may well outlive the next reset() of the
+/// arena, e.g., an interpreter copied out of a tick to be processed later.
+/// @tparam T the type of the allocated elements.
+template <typename T>
+class ArenaAllocator
+{
+    template <typename U>
+    friend class ArenaAllocator;
+
+private:
+    /// The arena, nullptr if we use the heap.
+    Arena *arena;
+
+public:
+    /// @brief The type of the allocated elements.
+    using value_type                             = T;
+    /// @brief Moving a container also moves its arena.
+    using propagate_on_container_move_assignment = std::true_type;
+    /// @brief Swapping two containers also swaps their arenas.
+    using propagate_on_container_swap            = std::true_type;
+
+    /// @brief Constructor.
+    /// @param _arena the arena, nullptr to use the heap.
+    ArenaAllocator(Arena *_arena = nullptr) noexcept
+        : arena(_arena)
+    {
+    }
+
+    /// @brief Converting constructor.
+    /// @param other the allocator to rebind.
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept
+        : arena(other.arena)
+    {
+    }
+
+    /// @brief Provides the allocator used by the copy of a container.
+    /// @return an allocator which uses the heap.
+    auto select_on_container_copy_construction() const noexcept -> ArenaAllocator { return ArenaAllocator(); }
+
+    /// @brief Provides the arena.
+    /// @return the arena, nullptr if we use the heap.
+    auto get_arena() const noexcept -> Arena * { return arena; }
+
+    /// @brief Allocates memory for the given number of elements.
+    /// @param n the number of elements.
+    /// @return a pointer to the memory.
+    auto allocate(std::size_t n) -> T *
+    {
+        if (arena != nullptr) {
+            return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    /// @brief Releases the memory, which does nothing when using an arena.
+    /// @param p the memory.
+    void deallocate(T *p, std::size_t) noexcept
+    {
+        if (arena == nullptr) {
+            ::operator delete(p);
+        }
+    }
+
+    /// @brief Two allocators are equal if they use the same arena.
+    /// @param lhs the first allocator.
+    /// @param rhs the second allocator.
+    /// @return true if they use the same arena.
+    template <typename U>
+    friend auto operator==(const ArenaAllocator &lhs, const ArenaAllocator<U> &rhs) noexcept -> bool
+    {
+        return lhs.get_arena() == rhs.get_arena();
+    }
+
+    /// @brief Two allocators are different if they use a different arena.
+    /// @param lhs the first allocator.
+    /// @param rhs the second allocator.
+    /// @return true if they use a different arena.
+    template <typename U>
+    friend auto operator!=(const ArenaAllocator &lhs, const ArenaAllocator<U> &rhs) noexcept -> bool
+    {
+        return lhs.get_arena() != rhs.get_arena();
+    }
+};
+
+} // namespace interpreter
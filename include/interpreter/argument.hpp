@@ -8,47 +8,140 @@
 #pragma once
 
 #include <climits>
+#include <cstdint>
 #include <iostream>
+#include <string_view>
 
 #include <ustr/check.hpp>
 #include <ustr/manipulate.hpp>
 #include <ustr/utility.hpp>
 
 #include "config.hpp"
+#include "option_set.hpp"
+#include "prefix.hpp"
+#include "tokenizer.hpp"
 
 namespace interpreter
 {
 
-/// @brief Represents a selectable option with associated names.
-///
-/// @details Each option has a unique identifier and a list of names (aliases)
-/// that can be used to reference it. This structure is used to map input
-/// arguments to their corresponding options based on string comparisons.
-struct Option {
-    unsigned option;                ///< Unique identifier for the option.
-    std::vector<std::string> names; ///< List of names or aliases for the option.
-};
-
 /// @brief Allows to easily manage input arguments from players.
+///
+/// @details An argument does not own its text when it is created by the
+/// Interpreter: it only stores the offsets of the `original` word and of the
+/// `content` inside the interpreter's copy of the input line, so that parsing
+/// a line does not allocate a string per word. Arguments created on their own,
+/// or whose content is modified, keep a private copy of their text instead,
+/// inside a small inline buffer, or on the heap when it does not fit. The
+/// argument fits in a single cache line, so a vector of arguments is one
+/// contiguous block. The prefixes of the words found by the Interpreter are
+/// evaluated the first time they, or the content, are needed, so the words
+/// which are only copied back, e.g., by substr(), cost nothing more than the
+/// tokenization. Hence, even the const methods of an argument must not be
+/// called by several threads at the same time. The Interpreter also keeps a
+/// lowercase copy of the input line, which its arguments use to compare words
+/// without considering the case, instead of folding every character on every
+/// comparison; the other arguments fold their text as they compare it.
 class Argument
 {
+    friend class Interpreter;
+
+public:
+    /// @brief The longest text kept inside the argument, without allocating.
+    static constexpr std::size_t inline_capacity = 16;
+
 private:
-    /// The original argument string.
-    std::string original;
-    /// The string with both the index and the quantity removed.
-    std::string content;
+    /// @brief The flag of the arguments whose prefixes have not been evaluated yet.
+    static constexpr std::uint8_t unresolved = 1U << 0U;
+
+    /// The external buffer the offsets refer to, nullptr if the text is private.
+    const char *source;
+    /// The configuration used to evaluate the prefix, nullptr to use the current snapshot.
+    const Config *configuration;
+    /// The position of the word inside the input of the interpreter, kept when the text becomes private.
+    std::uint32_t position;
+    /// The position of the original argument inside the buffer.
+    std::uint32_t original_begin;
+    /// The length of the original argument.
+    std::uint32_t original_length;
+    /// The position of the content (index and quantity removed) inside the buffer.
+    mutable std::uint32_t content_begin;
+    /// The length of the content.
+    mutable std::uint32_t content_length;
     /// The provided index.
-    std::size_t index;
+    mutable std::uint32_t index;
     /// The provided quantity.
-    std::size_t quantity;
+    mutable std::uint32_t quantity;
     /// Struct containing all the flags associated with this argument.
-    unsigned prefix;
+    mutable std::uint8_t prefix;
+    /// If the private copy of the text is on the heap.
+    bool allocated;
+    union {
+        /// The private copy of the text, when it is short enough.
+        char local[inline_capacity];
+        /// The private copy of the text, when it does not fit inside `local`.
+        char *heap;
+        /// The lowercase copy of the external buffer, with the same offsets, or nullptr.
+        const char *folded;
+    };
 
 public:
     /// @brief Constructor.
     /// @param _original the orginal content of the argument.
     explicit Argument(const std::string &_original);
 
+    /// @brief Constructs an argument which refers to a word inside an external buffer.
+    /// @param _source the buffer containing the word, it must outlive the argument.
+    /// @param _begin the position of the word inside the buffer.
+    /// @param _length the length of the word.
+    /// @param _folded the lowercase copy of the buffer, nullptr if there is none.
+    explicit Argument(const char *_source, std::size_t _begin, std::size_t _length, const char *_folded = nullptr);
+
+    /// @brief Constructs an argument from a word found by the Tokenizer, reusing the symbol positions it found.
+    /// @param _source the buffer containing the word, it must outlive the argument.
+    /// @param token the word, with the position of its prefix symbols.
+    /// @param config the configuration used to find the symbols, it must outlive the argument.
+    /// @param _folded the lowercase copy of the buffer, nullptr if there is none.
+    explicit Argument(const char *_source, const Token &token, const Config &config, const char *_folded = nullptr);
+
+    /// @brief Constructor, from a word whose prefixes were already evaluated.
+    /// @param _source the buffer containing the word, it must outlive the argument.
+    /// @param _begin the position of the word inside the buffer.
+    /// @param _length the length of the word.
+    /// @param _prefix the prefixes of the word, with the content relative to its start.
+    /// @param config the configuration, it must outlive the argument.
+    /// @param _folded the lowercase copy of the buffer, nullptr if there is none.
+    explicit Argument(
+        const char *_source,
+        std::size_t _begin,
+        std::size_t _length,
+        const Prefix &_prefix,
+        const Config &config,
+        const char *_folded = nullptr);
+
+    /// @brief Copy constructor.
+    /// @details The copy owns its text, so it stays valid after the
+    /// interpreter it was taken from parses another line, or is destroyed.
+    /// @param other The instance to copy from.
+    Argument(const Argument &other);
+
+    /// @brief Move constructor.
+    /// @param other The instance to move from.
+    Argument(Argument &&other) noexcept;
+
+    /// @brief Copy assignment operator.
+    /// @details As the copy constructor, the argument takes its own copy of the text.
+    /// @param other The instance to copy from.
+    /// @return Reference to this instance.
+    auto operator=(const Argument &other) -> Argument &;
+
+    /// @brief Move assignment operator.
+    /// @param other The instance to move from.
+    /// @return Reference to this instance.
+    auto operator=(Argument &&other) noexcept -> Argument &;
+
+    /// @brief Destructor.
+    ~Argument();
+
     /// @brief Parse the given string and store the details inside the argument.
     /// @param _original the orginal content of the argument.
     void parse(const std::string &_original);
@@ -61,14 +154,24 @@ public:
     /// @return true if the content is empty, false otherwise.
     auto empty() const -> bool;
 
-    /// @brief Provides the original argument.
+    /// @brief Provides a copy of the original argument.
+    /// @details It allocates for long words, prefer get_original_view().
     /// @return the original string.
     auto get_original() const -> std::string;
 
-    /// @brief Provides the `content` with both index and quantity removed.
+    /// @brief Provides a view of the original argument.
+    /// @return the original string, valid as long as the argument is not modified.
+    auto get_original_view() const -> std::string_view;
+
+    /// @brief Provides a copy of the `content` with both index and quantity removed.
+    /// @details It allocates for long words, prefer get_content_view().
     /// @return the cleaned content.
     auto get_content() const -> std::string;
 
+    /// @brief Provides a view of the `content` with both index and quantity removed.
+    /// @return the cleaned content, valid as long as the argument is not modified.
+    auto get_content_view() const -> std::string_view;
+
     /// @brief Forces the content to a given string.
     /// @param _content the new value.
     void set_content(const std::string &_content);
@@ -78,16 +181,23 @@ public:
     auto get_index() const -> std::size_t;
 
     /// @brief Forces a new index.
-    /// @param _index the new value.
+    /// @param _index the new value, saturated to UINT32_MAX.
     void set_index(std::size_t _index);
 
+    /// @brief Maps the argument to one of the options, with a single lookup.
+    /// @param options the set of options.
+    /// @return the option, 0 if the argument does not match any of them.
+    auto map_to_option(const OptionSet &options) const -> unsigned;
+
     /// @brief Checks if the argument maps to one of the options.
+    /// @details This calls the function on every name, prefer the OptionSet overload.
     /// @param options the list of options.
     /// @param function binary comparison function.
     /// @return true if at least one of the conditions are true.
     template <typename Fun>
     auto map_to_option(const std::vector<Option> &options, Fun function) const -> unsigned
     {
+        std::string content = this->get_content();
         std::vector<Option>::const_iterator option_it;
         std::vector<std::string>::const_iterator name_it;
         for (option_it = options.begin(); option_it != options.end(); ++option_it) {
@@ -105,7 +215,7 @@ public:
     auto get_quantity() const -> std::size_t;
 
     /// @brief Forces a new quantity.
-    /// @param _quantity the new value.
+    /// @param _quantity the new value, saturated to UINT32_MAX.
     void set_quantity(std::size_t _quantity);
 
     /// @brief Checks if there is only one prefix, or there is no prefix.
@@ -128,6 +238,12 @@ public:
     /// @return true if the whole argument means `all`, false otherwise.
     auto means_all() const -> bool;
 
+    /// @brief Checks if the `content` begins with the given prefix.
+    /// @param _prefix the prefix.
+    /// @param sensitive enables case-sensitive check.
+    /// @return true if the content begins with the prefix, false otherwise.
+    auto begins_with(std::string_view _prefix, bool sensitive = false) const -> bool;
+
     /// @brief Checks if the argument is an abbreviation of the given full string.
     /// @param full_string the full string.
     /// @param sensitive enables case-sensitive check.
@@ -145,7 +261,7 @@ public:
     template <typename T>
     auto to_number() const -> T
     {
-        return ustr::to_number<T>(original);
+        return ustr::to_number<T>(this->get_original());
     }
 
     /// @brief Check if the `content`, not the `original` string, is equal to a given string.
@@ -170,14 +286,62 @@ public:
     friend auto operator<<(std::ostream &lhs, const Argument &rhs) -> std::ostream &;
 
 private:
-    /// Evaluates the index and quantity.
-    void evaluate_all_prefix();
-
-    /// Evaluates the index.
-    void evaluate_index();
-
-    /// Evaluates the quantity.
-    void evaluate_quantity();
+    /// @brief Selects the constructor which keeps referring to the same external buffer.
+    struct Shared {
+    };
+
+    /// @brief Copies an argument, without taking its own copy of the text.
+    /// @param other the argument.
+    Argument(const Argument &other, Shared);
+
+    /// @brief Copies an argument, still referring to the same external buffer.
+    /// @details Used by the interpreter, which then moves the copy to its own buffer, see Interpreter::rebase().
+    /// @param other the argument.
+    /// @return the copy.
+    static auto share(const Argument &other) -> Argument;
+
+    /// @brief Provides the configuration used to evaluate the prefix.
+    /// @return the configuration.
+    auto get_config() const -> const Config &;
+
+    /// @brief Provides the buffer the offsets refer to.
+    /// @return the start of the buffer.
+    auto data() const -> const char *;
+
+    /// @brief Provides the lowercase copy of the buffer the offsets refer to.
+    /// @return the start of the lowercase buffer, nullptr if there is none.
+    auto folded_data() const -> const char *;
+
+    /// @brief Checks if the `content` begins with a prefix which is already lowercase.
+    /// @param _prefix the lowercase prefix.
+    /// @return true if the content begins with the prefix, without considering the case.
+    auto begins_with_folded(std::string_view _prefix) const -> bool;
+
+    /// @brief Checks if the `content` must be ignored.
+    /// @param config the configuration.
+    /// @return true if it must be ignored, false otherwise.
+    auto must_ignore(const Config &config) const -> bool;
+
+    /// @brief Copies the text inside the private storage, so that it can be modified.
+    void detach();
+
+    /// @brief Replaces the private copy of the text with the concatenation of two strings.
+    /// @details The strings can refer to the current text.
+    /// @param first the first string.
+    /// @param second the second string.
+    void store(std::string_view first, std::string_view second = std::string_view());
+
+    /// @brief Provides the length of the private copy of the text.
+    /// @return the length, 0 if the text is inside an external buffer.
+    auto stored_length() const -> std::size_t;
+
+    /// @brief Evaluates the prefixes, if it was not done yet.
+    void resolve() const;
+
+    /// @brief Evaluates the index and quantity, given where their symbols are.
+    /// @param index_pos the position of the first index symbol inside the original, or npos.
+    /// @param quantity_pos the position of the first quantity symbol inside the original, or npos.
+    void evaluate_all_prefix(std::size_t index_pos, std::size_t quantity_pos) const;
 };
 
 } // namespace interpreter
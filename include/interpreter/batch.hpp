@@ -0,0 +1,151 @@
+/// @file batch.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the batch, which parses many input lines at once.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "config.hpp"
+#include "prefix.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief The result of parsing many input lines at once, e.g., a whole tick.
+///
+/// @details The lines are copied one after the other inside a single buffer,
+/// and tokenized in a single pass. The words are stored as a structure of
+/// arrays (offsets, flags, index and quantity), and every line refers to a
+/// contiguous range of words. Once the arrays have grown to fit a typical
+/// tick, parsing the next one does not allocate. A batch is not shared
+/// between threads: workers can each parse a slice of the lines inside their
+/// own batch. The total text of a batch must be smaller than 4 GiB.
+class ParseBatch
+{
+private:
+    /// The lines, separated by new lines.
+    std::string text;
+    /// The position of each line inside the text.
+    std::vector<std::uint32_t> line_begin;
+    /// The length of each line.
+    std::vector<std::uint32_t> line_length;
+    /// The first word of each line, plus the end of the last line.
+    std::vector<std::uint32_t> line_first;
+    /// The position of each word inside the text.
+    std::vector<std::uint32_t> word_begin;
+    /// The length of each word.
+    std::vector<std::uint32_t> word_length;
+    /// The position of the content of each word inside the text.
+    std::vector<std::uint32_t> content_begin;
+    /// The length of the content of each word.
+    std::vector<std::uint32_t> content_length;
+    /// The index of each word.
+    std::vector<std::uint32_t> index;
+    /// The quantity of each word.
+    std::vector<std::uint32_t> quantity;
+    /// The prefixes of each word.
+    std::vector<std::uint8_t> flags;
+    /// The configuration used to parse the lines.
+    std::shared_ptr<const Config> configuration;
+    /// If the configuration was chosen by the user, otherwise we follow the current snapshot.
+    bool pinned = false;
+
+public:
+    /// @brief Constructor.
+    explicit ParseBatch() = default;
+
+    /// @brief Constructor, which uses the given configuration instead of the current snapshot.
+    /// @param config the configuration, nullptr to follow the current snapshot.
+    explicit ParseBatch(std::shared_ptr<const Config> config);
+
+    /// @brief Parses the lines, replacing the previous ones.
+    /// @param lines the lines.
+    /// @param count the number of lines.
+    /// @param ignore if we should ignore the list of ignored words.
+    void parse(const std::string_view *lines, std::size_t count, bool ignore);
+
+    /// @brief Parses the lines, replacing the previous ones.
+    /// @param lines the lines.
+    /// @param ignore if we should ignore the list of ignored words.
+    void parse(const std::vector<std::string> &lines, bool ignore);
+
+    /// @brief Removes all the lines, keeping the memory for the next batch.
+    void clear();
+
+    /// @brief Provides the configuration used by the last parse.
+    /// @return the configuration.
+    auto get_config() const -> const std::shared_ptr<const Config> &;
+
+    /// @brief Provides the number of lines.
+    /// @return the number of lines.
+    auto size() const -> std::size_t;
+
+    /// @brief Provides the total number of words.
+    /// @return the number of words.
+    auto get_word_count() const -> std::size_t;
+
+    /// @brief Provides a line.
+    /// @param line the line.
+    /// @return the line, valid until the next call to parse.
+    auto get_line(std::size_t line) const -> std::string_view;
+
+    /// @brief Provides the first word of a line.
+    /// @param line the line.
+    /// @return the position of the word.
+    auto get_first_word(std::size_t line) const -> std::size_t;
+
+    /// @brief Provides the number of words of a line.
+    /// @param line the line.
+    /// @return the number of words.
+    auto get_word_count(std::size_t line) const -> std::size_t;
+
+    /// @brief Provides a word as it was typed.
+    /// @param word the word.
+    /// @return the word, valid until the next call to parse.
+    auto get_original_view(std::size_t word) const -> std::string_view;
+
+    /// @brief Provides a word without its prefixes.
+    /// @param word the word.
+    /// @return the content, valid until the next call to parse.
+    auto get_content_view(std::size_t word) const -> std::string_view;
+
+    /// @brief Provides the prefixes of a word.
+    /// @param word the word.
+    /// @return the prefixes, with the content relative to the start of the word.
+    auto get_prefix(std::size_t word) const -> Prefix;
+
+    /// @brief Provides the index of a word.
+    /// @param word the word.
+    /// @return the index.
+    auto get_index(std::size_t word) const -> std::size_t;
+
+    /// @brief Provides the quantity of a word.
+    /// @param word the word.
+    /// @return the quantity.
+    auto get_quantity(std::size_t word) const -> std::size_t;
+
+    /// @brief Checks if the word has the `all.` prefix.
+    /// @param word the word.
+    /// @return true if it has the prefix.
+    auto has_prefix_all(std::size_t word) const -> bool;
+
+    /// @brief Checks if the word has the `<quantity>*` prefix.
+    /// @param word the word.
+    /// @return true if it has the prefix.
+    auto has_quantity(std::size_t word) const -> bool;
+
+    /// @brief Checks if the word has the `<index>.` prefix.
+    /// @param word the word.
+    /// @return true if it has the prefix.
+    auto has_index(std::size_t word) const -> bool;
+};
+
+} // namespace interpreter
@@ -0,0 +1,106 @@
+/// @file command_queue.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a bounded lock-free queue of parsed commands, from many threads to the game loop.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "interpreter.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace interpreter
+{
+
+/// @brief Carries the parsed commands from the network threads to the game loop.
+///
+/// @details Any number of threads can push, while a single thread, the game
+/// loop, pops. The queue is a ring of slots, each one with its own sequence
+/// number (Vyukov's bounded queue): the producers claim a slot with a single
+/// compare-and-swap, and the consumer never uses one. The interpreters are
+/// never copied: pushing and popping swap the interpreter of the caller with
+/// the one inside the slot, so the caller gets back an interpreter whose
+/// buffers are reused by its next parse, and once the slots have warmed up
+/// moving a command allocates nothing.
+///
+/// Each session can have a limited number of commands inside the queue. When
+/// a session reaches its limit, push() refuses its commands, and the network
+/// thread should stop reading from that session until is_throttled() tells
+/// that the game loop has caught up. A flooding player thus slows down only
+/// their own session, and cannot fill the queue for everyone else.
+class CommandQueue
+{
+public:
+    /// @brief The outcome of push().
+    enum class Result : std::uint8_t {
+        accepted,     ///< The command is inside the queue.
+        session_full, ///< The session has too many commands inside the queue.
+        queue_full,   ///< The queue is full.
+        bad_session,  ///< The session is not one of those the queue was built for.
+    };
+
+private:
+    /// @brief A slot of the ring, on its own cache lines.
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence; ///< The position the slot is ready for.
+        std::uint32_t session;             ///< The session which sent the command.
+        Interpreter args;                  ///< The command.
+    };
+
+    /// The slots, whose number is a power of two.
+    std::unique_ptr<Slot[]> slots;
+    /// The number of slots minus one.
+    std::size_t mask;
+    /// The next position to claim, shared by the producers.
+    alignas(64) std::atomic<std::size_t> tail;
+    /// The next position to read, used only by the consumer.
+    alignas(64) std::size_t head;
+    /// The number of commands of each session inside the queue.
+    std::unique_ptr<std::atomic<std::uint32_t>[]> pending;
+    /// The number of sessions.
+    std::size_t sessions;
+    /// The number of commands a session can have inside the queue.
+    std::uint32_t session_limit;
+
+public:
+    /// @brief Constructor.
+    /// @param capacity the number of commands the queue can hold, rounded up to a power of two.
+    /// @param _sessions the number of sessions, which are numbered from 0.
+    /// @param _session_limit the number of commands each session can have inside the queue.
+    CommandQueue(std::size_t capacity, std::size_t _sessions, std::uint32_t _session_limit = 8);
+
+    CommandQueue(const CommandQueue &)                     = delete;
+    auto operator=(const CommandQueue &) -> CommandQueue & = delete;
+
+    /// @brief Adds a command at the back of the queue, from any thread.
+    /// @param session the session which sent the command.
+    /// @param args the command, which is swapped with an interpreter left by
+    /// the consumer if the command is accepted, and left untouched otherwise.
+    /// @return the outcome.
+    auto push(std::uint32_t session, Interpreter &args) -> Result;
+
+    /// @brief Takes the command at the front of the queue, only from the consumer thread.
+    /// @param session where the session which sent the command is stored.
+    /// @param args where the command is stored, its previous content goes back to the producers.
+    /// @return false if the queue is empty.
+    auto pop(std::uint32_t &session, Interpreter &args) -> bool;
+
+    /// @brief Checks if a session has reached the number of commands it can have inside the queue.
+    /// @param session the session, one of those the queue was built for.
+    /// @return true if the network thread should stop reading from the session.
+    auto is_throttled(std::uint32_t session) const -> bool;
+
+    /// @brief Provides the number of commands of a session inside the queue.
+    /// @param session the session, one of those the queue was built for.
+    /// @return the number of commands.
+    auto get_pending(std::uint32_t session) const -> std::uint32_t;
+
+    /// @brief Provides the number of commands the queue can hold.
+    /// @return the capacity.
+    auto capacity() const -> std::size_t;
+};
+
+} // namespace interpreter
@@ -0,0 +1,88 @@
+/// @file command_table.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the table which dispatches the input to the commands.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "interpreter.hpp"
+#include "prefix_trie.hpp"
+
+#include <functional>
+
+namespace interpreter
+{
+
+/// @brief Dispatches the input to the command named by its first argument.
+///
+/// @details Commands are registered with their name, the minimum length of
+/// their abbreviations and a priority, which decides the winner when several
+/// commands share an abbreviation. Ambiguities are resolved when the commands
+/// are registered, so resolving the first argument only costs a walk through
+/// its characters, regardless of the number of commands. Free-text commands,
+/// e.g., `say` or `emote`, can limit the number of arguments they need, and
+/// read the rest of the line as it was typed with Interpreter::get_rest().
+class CommandTable
+{
+public:
+    /// @brief The function which handles a command.
+    using Handler = std::function<bool(Interpreter &)>;
+
+    /// @brief A registered command.
+    struct Command {
+        std::string name;       ///< The name of the command.
+        std::size_t min_length; ///< The minimum length of the abbreviations.
+        int priority;           ///< The priority over commands sharing an abbreviation.
+        Handler handler;        ///< The handler.
+        std::size_t arguments;  ///< The number of arguments parsed after the name, npos for all of them.
+    };
+
+private:
+    /// The list of commands.
+    std::vector<Command> commands;
+    /// The index from names and abbreviations to commands.
+    PrefixTrie index;
+
+public:
+    /// @brief Registers a command.
+    /// @param name the name of the command, matched without considering the case.
+    /// @param handler the function which handles the command.
+    /// @param min_length the minimum length of the abbreviations, npos if the name must be typed in full.
+    /// @param priority the priority over the commands sharing an abbreviation.
+    /// @param arguments the number of arguments parsed after the name, npos to parse all of them.
+    void add(
+        const std::string &name,
+        Handler handler,
+        std::size_t min_length = std::string::npos,
+        int priority           = 0,
+        std::size_t arguments  = std::string::npos);
+
+    /// @brief Prepares the index of the commands registered so far, which must be done before sharing the table
+    /// between threads, otherwise it happens on the first lookup.
+    void build() const;
+
+    /// @brief Resolves a word, or its abbreviation, to a command.
+    /// @param word the word.
+    /// @return the command, nullptr if there is none.
+    auto find(std::string_view word) const -> const Command *;
+
+    /// @brief Resolves the first argument, removes it, and runs the command.
+    /// @param args the parsed input.
+    /// @return the result of the handler, false if no command matches.
+    auto dispatch(Interpreter &args) const -> bool;
+
+    /// @brief Parses the input, only up to the arguments the command needs, and runs the command.
+    /// @param args where the input is parsed.
+    /// @param input the input.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @return the result of the handler, false if no command matches.
+    auto dispatch(Interpreter &args, std::string_view input, bool ignore) const -> bool;
+
+    /// @brief Provides the number of registered commands.
+    /// @return the number of commands.
+    auto size() const -> std::size_t;
+};
+
+} // namespace interpreter
@@ -0,0 +1,540 @@
+/// @file command_task.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the coroutine handlers, for the commands which take more than one tick.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+// The library only needs C++17, the coroutine handlers are available to the
+// projects which build with C++20.
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)
+
+#include "command_table.hpp"
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <new>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+namespace interpreter
+{
+
+class CommandScheduler;
+
+/// @brief Recycles the frames of the coroutines.
+///
+/// @details The frames are grouped by size, in steps of a cache line, and a
+/// released frame is kept to be handed out to the next coroutine of the same
+/// size, so once the pool has warmed up starting a command does not allocate.
+/// Each thread has its own pool, see local(): a frame must be released by the
+/// thread which created it, which is the case when the game loop runs the
+/// scheduler. The frames released after the pool of their thread was
+/// destroyed, e.g., by a scheduler with static storage, go back to the heap.
+class FramePool
+{
+private:
+    /// The size of the groups of frames.
+    static constexpr std::size_t granularity = 64;
+    /// The number of groups, the larger frames are not recycled.
+    static constexpr std::size_t groups = 64;
+
+    /// @brief A released frame, linked to the next one of the same group.
+    struct Block {
+        Block *next; ///< The next released frame.
+    };
+
+    /// The released frames of each group.
+    Block *released[groups] = {};
+    /// The number of frames taken from the heap.
+    std::size_t allocated = 0;
+    /// The number of frames handed out again.
+    std::size_t reused = 0;
+
+    /// @brief Constructor, the pools are only created by local().
+    FramePool() = default;
+
+    /// @brief Tells if the pool of the calling thread was destroyed, when the thread exits.
+    /// @details The flag has no destructor, so it can still be read afterwards.
+    /// @return the flag.
+    static auto destroyed() -> bool &
+    {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+public:
+    FramePool(const FramePool &)                     = delete;
+    auto operator=(const FramePool &) -> FramePool & = delete;
+
+    /// @brief Destructor, which gives the released frames back to the heap.
+    ~FramePool()
+    {
+        for (Block *&head : released) {
+            while (head != nullptr) {
+                Block *next = head->next;
+                ::operator delete(static_cast<void *>(head));
+                head = next;
+            }
+        }
+        destroyed() = true;
+    }
+
+    /// @brief Provides the pool of the calling thread.
+    /// @return the pool.
+    static auto local() -> FramePool &
+    {
+        thread_local FramePool pool;
+        return pool;
+    }
+
+    /// @brief Gives a frame back to the pool of the calling thread, or to the heap if the pool is gone.
+    /// @param frame the frame.
+    /// @param size the size of the frame, the same given to allocate().
+    static void release(void *frame, std::size_t size)
+    {
+        if (destroyed()) {
+            ::operator delete(frame);
+        } else {
+            FramePool::local().deallocate(frame, size);
+        }
+    }
+
+    /// @brief Hands out a frame.
+    /// @param size the size of the frame.
+    /// @return the frame.
+    auto allocate(std::size_t size) -> void *
+    {
+        std::size_t group = (size + granularity - 1) / granularity;
+        if (group >= groups) {
+            return ::operator new(size);
+        }
+        if (released[group] != nullptr) {
+            Block *block     = released[group];
+            released[group]  = block->next;
+            ++reused;
+            return block;
+        }
+        ++allocated;
+        return ::operator new(group * granularity);
+    }
+
+    /// @brief Keeps a frame, to hand it out again.
+    /// @param frame the frame.
+    /// @param size the size of the frame, the same given to allocate().
+    void deallocate(void *frame, std::size_t size)
+    {
+        std::size_t group = (size + granularity - 1) / granularity;
+        if (group >= groups) {
+            ::operator delete(frame);
+            return;
+        }
+        released[group] = new (frame) Block{released[group]};
+    }
+
+    /// @brief Provides the number of frames taken from the heap.
+    /// @return the number of frames.
+    auto get_allocated() const -> std::size_t { return allocated; }
+
+    /// @brief Provides the number of frames handed out again, without touching the heap.
+    /// @return the number of frames.
+    auto get_reused() const -> std::size_t { return reused; }
+};
+
+/// @brief The result of a coroutine handler, which can wait for ticks and for the input of its session.
+///
+/// @details A handler becomes a coroutine by returning a CommandTask, and
+/// taking its Interpreter by value, so that the arguments live inside its
+/// frame for as long as the command runs:
+/// @code
+/// auto do_give(std::uint32_t session, Interpreter args) -> CommandTask
+/// {
+///     send(session, "Are you sure?");
+///     Interpreter *answer = co_await wait_input(50);
+///     if ((answer == nullptr) || !(*answer)[0].is_abbreviation_of("yes")) {
+///         co_return false;
+///     }
+///     co_await wait_ticks(3);
+///     co_return give(args[0], args[1]);
+/// }
+/// @endcode
+class CommandTask
+{
+public:
+    /// @brief The state of the coroutine, shared with the scheduler.
+    struct promise_type {
+        CommandScheduler *scheduler = nullptr; ///< The scheduler running the task.
+        std::uint64_t id            = 0;       ///< The identifier of the task inside the scheduler.
+        std::uint32_t session       = 0;       ///< The session which sent the command.
+        std::uint64_t generation    = 0;       ///< Incremented at every resume, to recognize stale timers.
+        Interpreter input;                     ///< The last input received with wait_input().
+        bool timed_out  = false;               ///< If the last wait_input() expired.
+        bool result     = false;               ///< The value given to co_return.
+        std::exception_ptr exception;          ///< The exception which ended the task.
+
+        /// @brief Takes the frame from the pool of the thread.
+        static auto operator new(std::size_t size) -> void * { return FramePool::local().allocate(size); }
+
+        /// @brief Gives the frame back to the pool of the thread.
+        static void operator delete(void *frame, std::size_t size) { FramePool::release(frame, size); }
+
+        /// @brief Wraps the coroutine inside the task returned by the handler.
+        auto get_return_object() -> CommandTask
+        {
+            return CommandTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        /// @brief The task starts when the scheduler takes it.
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+
+        /// @brief The scheduler destroys the frame, once it has read the result.
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+
+        /// @brief Keeps the value given to co_return.
+        void return_value(bool value) { result = value; }
+
+        /// @brief Keeps the exception, the scheduler throws it again once the frame is destroyed.
+        void unhandled_exception() { exception = std::current_exception(); }
+    };
+
+    /// The type of the handle of the coroutine.
+    using Handle = std::coroutine_handle<promise_type>;
+
+private:
+    /// The coroutine, empty once the scheduler took it.
+    Handle handle;
+
+    /// @brief Constructor.
+    /// @param _handle the coroutine.
+    explicit CommandTask(Handle _handle)
+        : handle(_handle)
+    {
+        // Nothing to do.
+    }
+
+    friend class CommandScheduler;
+
+public:
+    CommandTask(const CommandTask &)                     = delete;
+    auto operator=(const CommandTask &) -> CommandTask & = delete;
+
+    /// @brief Move constructor.
+    /// @param other the task to move from.
+    CommandTask(CommandTask &&other) noexcept
+        : handle(std::exchange(other.handle, nullptr))
+    {
+        // Nothing to do.
+    }
+
+    /// @brief Move assignment operator.
+    /// @param other the task to move from.
+    /// @return Reference to the task.
+    auto operator=(CommandTask &&other) noexcept -> CommandTask &
+    {
+        if (this != &other) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    /// @brief Destructor, which destroys the coroutine if it was never started.
+    ~CommandTask()
+    {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+};
+
+/// @brief Runs the coroutine handlers, and resumes them on the ticks of the game loop.
+///
+/// @details The commands are registered as in a CommandTable, and dispatch()
+/// starts the one named by the first argument. A command runs until it
+/// completes or waits, either for some ticks, see wait_ticks(), or for the
+/// next line of its session, see wait_input(). While a command of a session
+/// waits for its input, the lines of that session are given to the command
+/// instead of being dispatched, e.g., the answer to a confirmation. Each
+/// waiting command costs its frame, taken from the FramePool, and an entry
+/// inside the timers. The scheduler, and the commands it runs, must be used
+/// by a single thread, i.e., the game loop.
+class CommandScheduler
+{
+public:
+    /// @brief The function which starts a command, it receives its own copy of the arguments.
+    using Handler = std::function<CommandTask(std::uint32_t, Interpreter)>;
+
+private:
+    /// @brief A task waiting for a tick.
+    struct Timer {
+        std::uint64_t tick;       ///< The tick which resumes the task.
+        std::uint64_t id;         ///< The task.
+        std::uint64_t generation; ///< The generation of the task when it started waiting.
+
+        auto operator>(const Timer &other) const -> bool
+        {
+            return (tick != other.tick) ? (tick > other.tick) : (id > other.id);
+        }
+    };
+
+    /// The commands.
+    CommandTable table;
+    /// The tasks which are waiting.
+    std::unordered_map<std::uint64_t, CommandTask::Handle> tasks;
+    /// The tasks waiting for the input of each session, the oldest first.
+    std::unordered_map<std::uint32_t, std::deque<std::uint64_t>> readers;
+    /// The tasks waiting for a tick, the earliest first.
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+    /// The current tick.
+    std::uint64_t now = 0;
+    /// The identifier of the next task.
+    std::uint64_t next_id = 1;
+    /// The session of the command being dispatched.
+    std::uint32_t dispatching = 0;
+    /// The number of tasks completed.
+    std::uint64_t completed = 0;
+
+    friend struct TickAwaiter;
+    friend struct InputAwaiter;
+
+public:
+    CommandScheduler() = default;
+
+    CommandScheduler(const CommandScheduler &)                     = delete;
+    auto operator=(const CommandScheduler &) -> CommandScheduler & = delete;
+
+    /// @brief Destructor, which destroys the tasks still waiting.
+    /// @details It can run after the FramePool of the thread, e.g., for a
+    /// scheduler with static storage, in which case the frames go to the heap.
+    ~CommandScheduler()
+    {
+        for (auto &task : tasks) {
+            task.second.destroy();
+        }
+    }
+
+    /// @brief Registers a command.
+    /// @param name the name of the command, matched without considering the case.
+    /// @param handler the function which starts the command.
+    /// @param min_length the minimum length of the abbreviations, npos if the name must be typed in full.
+    /// @param priority the priority over the commands sharing an abbreviation.
+    void add(const std::string &name, Handler handler, std::size_t min_length = std::string::npos, int priority = 0)
+    {
+        table.add(name, [this, handler = std::move(handler)](Interpreter &args) {
+            return this->start(dispatching, handler(dispatching, std::move(args)));
+        }, min_length, priority);
+    }
+
+    /// @brief Gives a line to the command of the session waiting for it, or starts the command it names.
+    /// @param session the session which sent the line.
+    /// @param args the parsed line, which is moved inside the command receiving it.
+    /// @return false if no command matches, otherwise true if the command is
+    /// still running, or the value it gave to co_return if it completed.
+    auto dispatch(std::uint32_t session, Interpreter &args) -> bool
+    {
+        auto reader = readers.find(session);
+        if (reader != readers.end()) {
+            std::uint64_t id = reader->second.front();
+            reader->second.pop_front();
+            if (reader->second.empty()) {
+                readers.erase(reader);
+            }
+            CommandTask::Handle handle = tasks.at(id);
+            std::swap(handle.promise().input, args);
+            handle.promise().timed_out = false;
+            return this->resume(id, handle);
+        }
+        dispatching = session;
+        return table.dispatch(args);
+    }
+
+    /// @brief Starts a task, and runs it until it completes or waits.
+    /// @param session the session which sent the command.
+    /// @param task the task.
+    /// @return true if the task is still running, or the value it gave to co_return.
+    auto start(std::uint32_t session, CommandTask task) -> bool
+    {
+        CommandTask::Handle handle = std::exchange(task.handle, nullptr);
+        std::uint64_t id           = next_id++;
+        handle.promise().scheduler = this;
+        handle.promise().id        = id;
+        handle.promise().session   = session;
+        tasks.emplace(id, handle);
+        return this->resume(id, handle);
+    }
+
+    /// @brief Advances to the next tick, and resumes the tasks waiting for it.
+    /// @return the number of tasks resumed.
+    auto tick() -> std::size_t
+    {
+        ++now;
+        std::size_t resumed = 0;
+        while (!timers.empty() && (timers.top().tick <= now)) {
+            Timer timer = timers.top();
+            timers.pop();
+            auto task = tasks.find(timer.id);
+            if ((task == tasks.end()) || (task->second.promise().generation != timer.generation)) {
+                // The task has completed, or it was resumed by its input.
+                continue;
+            }
+            CommandTask::Handle handle = task->second;
+            if (this->forget_reader(handle.promise())) {
+                handle.promise().timed_out = true;
+            }
+            this->resume(timer.id, handle);
+            ++resumed;
+        }
+        return resumed;
+    }
+
+    /// @brief Destroys the tasks of a session, e.g., when it disconnects.
+    /// @details The tasks are destroyed where they wait, without being
+    /// resumed, and their timers are ignored when they expire. It visits all
+    /// the waiting tasks, since those waiting for a tick are not indexed by session.
+    /// @param session the session.
+    /// @return the number of tasks destroyed.
+    auto cancel(std::uint32_t session) -> std::size_t
+    {
+        readers.erase(session);
+        std::size_t cancelled = 0;
+        for (auto task = tasks.begin(); task != tasks.end();) {
+            if (task->second.promise().session == session) {
+                task->second.destroy();
+                task = tasks.erase(task);
+                ++cancelled;
+            } else {
+                ++task;
+            }
+        }
+        return cancelled;
+    }
+
+    /// @brief Provides the current tick.
+    /// @return the tick.
+    auto get_tick() const -> std::uint64_t { return now; }
+
+    /// @brief Provides the number of tasks which are waiting.
+    /// @return the number of tasks.
+    auto size() const -> std::size_t { return tasks.size(); }
+
+    /// @brief Provides the number of tasks completed so far.
+    /// @return the number of tasks.
+    auto get_completed() const -> std::uint64_t { return completed; }
+
+    /// @brief Checks if a command of the session is waiting for its input.
+    /// @param session the session.
+    /// @return true if the next line of the session goes to a command.
+    auto is_reading(std::uint32_t session) const -> bool { return readers.find(session) != readers.end(); }
+
+private:
+    /// @brief Resumes a task, and destroys it if it completed.
+    /// @param id the task.
+    /// @param handle the coroutine.
+    /// @return true if the task is still running, or the value it gave to co_return.
+    auto resume(std::uint64_t id, CommandTask::Handle handle) -> bool
+    {
+        ++handle.promise().generation;
+        handle.resume();
+        if (!handle.done()) {
+            return true;
+        }
+        bool result                  = handle.promise().result;
+        std::exception_ptr exception = handle.promise().exception;
+        tasks.erase(id);
+        handle.destroy();
+        ++completed;
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return result;
+    }
+
+    /// @brief Stops a task from waiting for the input of its session.
+    /// @param promise the state of the task.
+    /// @return true if it was waiting for its input.
+    auto forget_reader(const CommandTask::promise_type &promise) -> bool
+    {
+        auto reader = readers.find(promise.session);
+        if (reader == readers.end()) {
+            return false;
+        }
+        for (auto it = reader->second.begin(); it != reader->second.end(); ++it) {
+            if (*it == promise.id) {
+                reader->second.erase(it);
+                if (reader->second.empty()) {
+                    readers.erase(reader);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Makes a task wait for a tick.
+    /// @param promise the state of the task.
+    /// @param ticks the number of ticks to wait.
+    void wait(const CommandTask::promise_type &promise, std::uint64_t ticks)
+    {
+        // Resuming the task changes its generation, which makes the timer stale.
+        timers.push(Timer{now + ticks, promise.id, promise.generation});
+    }
+
+    /// @brief Makes a task wait for the input of its session.
+    /// @param promise the state of the task.
+    void read(const CommandTask::promise_type &promise) { readers[promise.session].push_back(promise.id); }
+};
+
+/// @brief Suspends a command for some ticks.
+struct TickAwaiter {
+    std::uint64_t ticks; ///< The number of ticks.
+
+    auto await_ready() const noexcept -> bool { return ticks == 0; }
+
+    void await_suspend(CommandTask::Handle handle) const
+    {
+        handle.promise().scheduler->wait(handle.promise(), ticks);
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/// @brief Suspends a command until its session sends a line.
+struct InputAwaiter {
+    std::uint64_t timeout;                     ///< The most ticks to wait, 0 to wait forever.
+    CommandTask::promise_type *promise = nullptr; ///< The state of the command.
+
+    auto await_ready() const noexcept -> bool { return false; }
+
+    void await_suspend(CommandTask::Handle handle)
+    {
+        promise = &handle.promise();
+        promise->scheduler->read(*promise);
+        if (timeout > 0) {
+            promise->scheduler->wait(*promise, timeout);
+        }
+    }
+
+    /// @return the line, which lives inside the frame until the next wait_input(), nullptr if the time ran out.
+    auto await_resume() const noexcept -> Interpreter * { return promise->timed_out ? nullptr : &promise->input; }
+};
+
+/// @brief Suspends a command for some ticks.
+/// @param ticks the number of ticks, 0 does not suspend.
+/// @return what the command must co_await.
+inline auto wait_ticks(std::uint64_t ticks) -> TickAwaiter { return TickAwaiter{ticks}; }
+
+/// @brief Suspends a command until its session sends a line.
+/// @param timeout the most ticks to wait, 0 to wait forever.
+/// @return what the command must co_await, which gives the line, or nullptr if the time ran out.
+inline auto wait_input(std::uint64_t timeout = 0) -> InputAwaiter { return InputAwaiter{timeout, nullptr}; }
+
+} // namespace interpreter
+
+#endif
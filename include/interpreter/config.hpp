@@ -7,17 +7,95 @@
 
 #pragma once
 
+#include "word_set.hpp"
+
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace interpreter
 {
 
+/// @brief An immutable snapshot of the configuration of the interpreter.
+///
+/// @details Snapshots are shared between threads through std::shared_ptr, and
+/// never change once built: reloading the configuration means building a new
+/// snapshot and installing it with config::install(). Interpreters which are
+/// parsing keep using the snapshot they started with, so they never lock.
+class Config
+{
+private:
+    /// The list of words meaning "all".
+    std::vector<std::string> list_of_all;
+    /// The list of words to ignore.
+    std::vector<std::string> list_of_ignore;
+    /// The list of symbols for specifying a quantity.
+    std::string symbols_multiplier;
+    /// The list of symbols for specifying an index.
+    std::string symbols_index;
+    /// The compiled list of words meaning "all".
+    WordSet all_words;
+    /// The compiled list of words to ignore.
+    WordSet ignored_words;
+    /// The unique identifier of the snapshot.
+    std::uint64_t version;
+
+public:
+    /// @brief Constructor.
+    /// @param _list_of_all the list of words meaning "all".
+    /// @param _list_of_ignore the list of words to ignore.
+    /// @param _symbols_multiplier the list of symbols for specifying a quantity.
+    /// @param _symbols_index the list of symbols for specifying an index.
+    Config(
+        std::vector<std::string> _list_of_all,
+        std::vector<std::string> _list_of_ignore,
+        std::string _symbols_multiplier,
+        std::string _symbols_index);
+
+    /// @brief Checks if the given word means all.
+    /// @param word the word to check.
+    /// @param folded if the word is already lowercase, so that it is not folded again.
+    /// @return true if it means all, false otherwise.
+    auto means_all(std::string_view word, bool folded = false) const -> bool;
+
+    /// @brief Checks if the given word must be ignored.
+    /// @param word the word to check.
+    /// @param folded if the word is already lowercase, so that it is not folded again.
+    /// @return true if it must be ignored, false otherwise.
+    auto must_ignore(std::string_view word, bool folded = false) const -> bool;
+
+    /// @brief Provides the list of words meaning "all".
+    /// @return the list of words.
+    auto get_list_of_all() const -> const std::vector<std::string> &;
+
+    /// @brief Provides the list of words to ignore.
+    /// @return the list of words.
+    auto get_list_of_ignore() const -> const std::vector<std::string> &;
+
+    /// @brief Provides the list of symbols for specifying a quantity.
+    /// @return the list of symbols.
+    auto get_symbols_multiplier() const -> const std::string &;
+
+    /// @brief Provides the list of symbols for specifying an index.
+    /// @return the list of symbols.
+    auto get_symbols_index() const -> const std::string &;
+
+    /// @brief Provides the unique identifier of the snapshot, different for every snapshot ever built.
+    /// @return the identifier.
+    auto get_version() const -> std::uint64_t;
+};
+
 /// @brief MUD interpreter configuration.
 namespace config
 {
 
 /// @brief The list of words meaning "all".
+/// @details These lists are the source of the default snapshot (see
+/// snapshot()), which is rebuilt when they change, until another snapshot is
+/// installed. They must not be modified while other threads are parsing, use
+/// install() for that.
 extern std::vector<std::string> list_of_all;
 /// @brief The list of words to ingnore.
 extern std::vector<std::string> list_of_ingnore;
@@ -26,15 +104,38 @@ extern std::string list_of_symbols_multiplier;
 /// @brief The list of symbols for specifying an index.
 extern std::string list_of_symbols_index;
 
-/// @brief Checks if the given word means all.
+/// @brief Provides the snapshot currently installed.
+/// @details Unless a snapshot was installed before, the first call builds one
+/// from the lists above. Afterwards, it compares the version of the installed
+/// snapshot, without locking: every thread keeps a copy of the snapshot,
+/// refreshed when a new one is installed. While the snapshot is the one built
+/// from the lists, it also compares them with the snapshot, and rebuilds it
+/// when they changed; installing a snapshot of your own skips that.
+/// @return the snapshot.
+auto snapshot() -> const std::shared_ptr<const Config> &;
+
+/// @brief Provides the version of the snapshot currently installed, without loading it.
+/// @details It is a single atomic read, so it can be checked as often as needed.
+/// @return the version, see Config::get_version(), 0 if there is no snapshot yet.
+auto get_version() -> std::uint64_t;
+
+/// @brief Atomically replaces the current snapshot.
+/// @details Interpreters pick it up at their next parse, unless they were given their own snapshot.
+/// @param config the new snapshot, nullptr to go back to the one built from the lists above.
+void install(std::shared_ptr<const Config> config);
+
+/// @brief Builds a snapshot from the lists above, and installs it, so that it follows their changes.
+void update();
+
+/// @brief Checks if the given word means all, using the current snapshot.
 /// @param word the word to check.
 /// @return true if it means all, false otherwise.
-auto means_all(const std::string &word) -> bool;
+auto means_all(std::string_view word) -> bool;
 
-/// @brief Checks if the given word must be ignored.
+/// @brief Checks if the given word must be ignored, using the current snapshot.
 /// @param word the word to check.
 /// @return true if it must be ignored, false otherwise.
-auto must_ignore(const std::string &word) -> bool;
+auto must_ignore(std::string_view word) -> bool;
 
 } // namespace config
 
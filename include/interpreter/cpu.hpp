@@ -0,0 +1,38 @@
+/// @file cpu.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Detects, at runtime, the instruction sets supported by the processor.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64)
+/// @brief Defined on x86-64, where SSE2 is always available and AVX2 is checked at runtime.
+#define MUDINT_X86 1
+#endif
+
+#if defined(MUDINT_X86) && (defined(__GNUC__) || defined(__clang__))
+/// @brief Compiles a function for AVX2, without requiring AVX2 for the rest of the library.
+#define MUDINT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+/// @brief Compiles a function for AVX2, which needs nothing on the other compilers.
+#define MUDINT_TARGET_AVX2
+#endif
+
+namespace interpreter
+{
+
+/// @brief Instruction sets supported by the processor.
+namespace cpu
+{
+
+/// @brief Checks if the processor, and the operating system, support AVX2.
+/// @details The check is done once, the functions compiled with
+/// MUDINT_TARGET_AVX2 must only be called when this returns true.
+/// @return true if AVX2 can be used.
+auto has_avx2() -> bool;
+
+} // namespace cpu
+
+} // namespace interpreter
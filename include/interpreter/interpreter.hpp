@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include "arena.hpp"
 #include "argument.hpp"
+#include "batch.hpp"
 
 #include <iomanip>
 #include <iostream>
@@ -21,24 +23,67 @@ enum : unsigned char {
 namespace interpreter
 {
 
+class ParseCache;
+
 /// @brief Allows to simply handle players inputs.
+///
+/// @details The interpreter keeps a single copy of the input line, and its
+/// arguments refer to the words inside that copy. A lowercase copy is built
+/// along with it, so that the case-insensitive comparisons of the arguments,
+/// e.g., find(), compare the bytes as they are. Once the internal buffers
+/// have grown to fit the typical input, parsing a new line does not allocate.
+/// The buffers can also be placed inside an Arena, see Interpreter(Arena &).
 class Interpreter
 {
-private:
-    /// The original string.
-    std::string original;
-    /// List of arguments.
-    std::vector<Argument> arguments;
+    friend class ParseCache;
+    friend class Pipeline;
 
 public:
+    /// @brief The type of string used to store the input.
+    using string_type = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+    /// @brief The type of container used to store the arguments.
+    using vector_type = std::vector<Argument, ArenaAllocator<Argument>>;
     /// @brief Iterator for arguments.
-    using iterator       = std::vector<Argument>::iterator;
+    using iterator       = vector_type::iterator;
     /// @brief Constant iterator for arguments.
-    using const_iterator = std::vector<Argument>::const_iterator;
+    using const_iterator = vector_type::const_iterator;
+
+private:
+    /// The original string, which the arguments refer to.
+    string_type original;
+    /// The lowercase copy of the original string, with the same offsets.
+    string_type folded;
+    /// List of arguments.
+    vector_type arguments;
+    /// The configuration used to parse the input.
+    std::shared_ptr<const Config> configuration;
+    /// If the configuration was chosen by the user, otherwise we follow the current snapshot.
+    bool pinned = false;
+    /// The position of the text left unparsed, see parse(std::string_view, bool, std::size_t).
+    std::size_t rest_begin = 0;
+    /// The length of the text left unparsed.
+    std::size_t rest_length = 0;
+    /// The number of arguments removed from the front, which are skipped.
+    std::size_t head = 0;
 
+public:
     /// @brief Constructor.
     explicit Interpreter() = default;
 
+    /// @brief Constructor, which places the input and the arguments inside the arena.
+    /// @details The interpreter must be cleared before the arena is reset.
+    /// @param arena the arena, it must outlive the interpreter.
+    explicit Interpreter(Arena &arena);
+
+    /// @brief Constructor, which uses the given configuration instead of the current snapshot.
+    /// @param config the configuration, nullptr to follow the current snapshot.
+    explicit Interpreter(std::shared_ptr<const Config> config);
+
+    /// @brief Constructor, which places the input and the arguments inside the arena, and uses the given configuration.
+    /// @param arena the arena, it must outlive the interpreter.
+    /// @param config the configuration, nullptr to follow the current snapshot.
+    explicit Interpreter(Arena &arena, std::shared_ptr<const Config> config);
+
     /// @brief Constructor.
     /// @param input the string containing the input from the user.
     /// @param ignore if we should ignore the list of ignored words.
@@ -46,21 +91,21 @@ public:
 
     /// @brief Copy constructor.
     /// @param other The instance to copy from.
-    Interpreter(const Interpreter &other) = default;
+    Interpreter(const Interpreter &other);
 
     /// @brief Copy assignment operator.
     /// @param other The instance to copy from.
     /// @return Reference to the instance.
-    auto operator=(const Interpreter &other) -> Interpreter & = default;
+    auto operator=(const Interpreter &other) -> Interpreter &;
 
     /// @brief Move constructor.
     /// @param other The instance to move from.
-    Interpreter(Interpreter &&other) noexcept = default;
+    Interpreter(Interpreter &&other) noexcept;
 
     /// @brief Move assignment operator.
     /// @param other The instance to move from.
     /// @return Reference to the instance.
-    auto operator=(Interpreter &&other) noexcept -> Interpreter & = default;
+    auto operator=(Interpreter &&other) noexcept -> Interpreter &;
 
     /// @brief Destructor.
     ~Interpreter() = default;
@@ -69,6 +114,23 @@ public:
     /// @return a copy of the original string.
     auto get_original() const -> std::string;
 
+    /// @brief Provides a view of the original input string.
+    /// @return the original string, valid until the next call to parse.
+    auto get_original_view() const -> std::string_view;
+
+    /// @brief Provides the text which follows the arguments, when parse() was given a limit.
+    /// @details The spacing is the one typed by the user, only the trailing whitespace is removed.
+    /// @return the text, valid until the next call to parse, empty if the whole line was parsed.
+    auto get_rest() const -> std::string_view;
+
+    /// @brief Provides the configuration used by the last parse.
+    /// @return the configuration.
+    auto get_config() const -> const Config &;
+
+    /// @brief Sets the configuration used to parse the next inputs.
+    /// @param config the configuration, nullptr to follow the snapshot installed with config::install().
+    void set_config(const std::shared_ptr<const Config> &config);
+
     /// @brief Returns the number of arguments.
     /// @return the number of arguments.
     auto size() const -> std::size_t;
@@ -80,19 +142,19 @@ public:
 
     /// @brief Returns an interator to the start of the list of argments.
     /// @return the start iterator.
-    inline auto begin() -> iterator;
+    auto begin() -> iterator;
 
     /// @brief Returns an interator to the start of the list of argments.
     /// @return the start iterator.
-    inline auto begin() const -> const_iterator;
+    auto begin() const -> const_iterator;
 
     /// @brief Returns an interator to the end of the list of argments.
     /// @return the end iterator.
-    inline auto end() -> iterator;
+    auto end() -> iterator;
 
     /// @brief Returns an interator to the end of the list of argments.
     /// @return the end iterator.
-    inline auto end() const -> const_iterator;
+    auto end() const -> const_iterator;
 
     /// @brief Allows to retrieve const reference to argument at given position.
     /// @param position the index at which we retrieve the argument.
@@ -104,12 +166,47 @@ public:
     /// @param ignore if we should ignore the list of ignored words.
     void parse(const char *input, bool ignore);
 
+    /// @brief Parse the input string.
+    /// @details When the limit is reached, the rest of the line is not split
+    /// into arguments, and is kept as it was typed, see get_rest().
+    /// @param input the input string, which does not need to be null-terminated.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @param limit the number of arguments to parse, npos to parse all of them.
+    void parse(std::string_view input, bool ignore, std::size_t limit = std::string_view::npos);
+
+    /// @brief Continues parsing the text left by the last parse, see get_rest().
+    /// @details The arguments already parsed are kept, and the configuration is the same.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @param limit the total number of arguments to parse, npos to parse all of them.
+    void parse_rest(bool ignore, std::size_t limit = std::string_view::npos);
+
+    /// @brief Loads a line parsed by a batch, without parsing it again.
+    /// @details The interpreter adopts the configuration used by the batch.
+    /// @param batch the batch.
+    /// @param line the line.
+    void parse(const ParseBatch &batch, std::size_t line);
+
+    /// @brief Removes the input and the arguments, and releases their memory.
+    /// @details This must be called before resetting the arena used by the interpreter.
+    void clear();
+
     /// @brief Finds the argument that mathes the input string.
     /// @param s the input string.
     /// @param exact if true, the string must match, otherwise it can just begin with it.
     /// @return the found argument, NULL if it was not found.
     auto find(std::string const &s, bool exact = false) const -> const Argument *;
 
+    /// @brief Provides the input from an argument up to another, as it was typed.
+    /// @details It does not copy the text, since the arguments know their
+    /// position inside the input. It only checks that nothing is missing
+    /// between them, e.g., the ignored words, the erased arguments, or those
+    /// assigned from elsewhere, which the input does not contain.
+    /// @param _start the starting index.
+    /// @param _end the index past the last argument, by default is the end of the argument list.
+    /// @return the text, valid until the next call to parse, empty if the
+    /// range is empty, or if the arguments are not contiguous inside the input.
+    auto substr_view(std::size_t _start, std::size_t _end = std::string::npos) const -> std::string_view;
+
     /// @brief Returns the string from the given argument to the end.
     /// @param _start the starting index.
     /// @param _end the final index, by default is the end of the argument list.
@@ -117,10 +214,18 @@ public:
     auto substr(std::size_t _start, std::size_t _end = std::string::npos) const -> std::string;
 
     /// @brief Erase the argument at the given position.
+    /// @details Erasing the first argument takes constant time, see pop_front().
     /// @param position the position where the argument should be removed.
     void erase(const std::size_t &position);
 
-    /// @brief Permanently removes the fill words.
+    /// @brief Removes the first argument, in constant time.
+    void pop_front();
+
+    /// @brief Removes the first arguments, in constant time.
+    /// @param count the number of arguments to remove, at most all of them.
+    void consume(std::size_t count);
+
+    /// @brief Permanently removes the fill words, in a single pass.
     void remove_ignored_words();
 
     /// @brief Prints a log of all the contained arguments.
@@ -135,6 +240,47 @@ public:
     /// @param position the index at which we retrieve the argument.
     /// @return the retrieved argument
     auto operator[](const std::size_t &position) const -> const Argument &;
+
+private:
+    /// @brief A word found by a previous parse, see load().
+    struct Word {
+        std::uint32_t begin;  ///< The position of the word inside the input.
+        std::uint32_t length; ///< The length of the word.
+        Prefix prefix;        ///< The prefixes of the word, with the content relative to its start.
+    };
+
+    /// @brief Follows the current snapshot, unless the user chose the configuration.
+    void refresh_config();
+
+    /// @brief Parses the input with the current configuration, without refreshing it.
+    /// @param input the input string.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @param limit the number of arguments to parse, npos to parse all of them.
+    void split(std::string_view input, bool ignore, std::size_t limit);
+
+    /// @brief Splits the input into arguments, starting from the given position.
+    /// @param begin the position.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @param limit the total number of arguments to parse, npos to parse all of them.
+    void split_from(std::size_t begin, bool ignore, std::size_t limit);
+
+    /// @brief Loads an input whose words were already found, without parsing it again.
+    /// @param input the input.
+    /// @param words the words.
+    /// @param count the number of words.
+    void load(std::string_view input, const Word *words, std::size_t count);
+
+    /// @brief Builds the lowercase copy of the original string.
+    void fold();
+
+    /// @brief Copies the arguments of another interpreter, still referring to its buffers.
+    /// @param other the arguments.
+    void share(const vector_type &other);
+
+    /// @brief Makes the arguments refer to the buffers of this interpreter.
+    /// @param previous the buffer they were referring to.
+    /// @param previous_folded the lowercase buffer they were referring to.
+    void rebase(const char *previous, const char *previous_folded);
 };
 
 } // namespace interpreter
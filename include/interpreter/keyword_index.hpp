@@ -0,0 +1,92 @@
+/// @file keyword_index.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines an index which resolves arguments to the objects they name.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "argument.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief Resolves arguments, e.g., `2.pen`, `3*coin` or `all.sword`, to the objects of a container.
+///
+/// @details The objects of a container (e.g., a room, or an inventory) are
+/// registered with their keywords, which are case-folded and sorted all at
+/// once, on the first lookup after the registrations or when build() is
+/// called, which must be done before sharing the index between threads.
+/// Since all the keywords beginning with the same abbreviation are
+/// contiguous, finding them takes a binary search, regardless of the number
+/// of objects. The matches are ordered as the objects were registered, and
+/// every object is matched once, even when it is registered several times or
+/// with several of the matching keywords. The index of the argument selects
+/// the first match, and its quantity how many matches are taken from there, or
+/// all of them when the prefix means "all".
+class KeywordIndex
+{
+private:
+    /// @brief A keyword of an object.
+    struct Entry {
+        std::string keyword; ///< The keyword, lowercase.
+        std::uint32_t order; ///< The order in which the keyword was registered.
+        std::uint32_t value; ///< The object.
+    };
+
+    /// The keywords, sorted by keyword and order, except for those registered after the last build().
+    mutable std::vector<Entry> entries;
+    /// The number of sorted keywords.
+    mutable std::size_t sorted;
+    /// The number of keywords registered so far.
+    std::uint32_t count;
+
+public:
+    /// @brief Constructor.
+    KeywordIndex();
+
+    /// @brief Registers a keyword of an object.
+    /// @details An object is registered once for each of its keywords.
+    /// @param keyword the keyword, compared without considering the case.
+    /// @param value the object.
+    void insert(std::string_view keyword, std::uint32_t value);
+
+    /// @brief Removes a keyword of an object.
+    /// @param keyword the keyword.
+    /// @param value the object.
+    /// @return true if the keyword was registered for the object.
+    auto erase(std::string_view keyword, std::uint32_t value) -> bool;
+
+    /// @brief Resolves an argument, using its index, quantity and "all" prefixes.
+    /// @param argument the argument, whose content abbreviates the keywords.
+    /// @param results where the matching objects are stored, it is cleared first.
+    /// @return the number of matching objects.
+    auto find(const Argument &argument, std::vector<std::uint32_t> &results) const -> std::size_t;
+
+    /// @brief Resolves a word.
+    /// @param word the word, which abbreviates the keywords.
+    /// @param index the position of the first match to take, starting from 1.
+    /// @param quantity the number of matches to take, npos to take all of them.
+    /// @param results where the matching objects are stored, it is cleared first.
+    /// @return the number of matching objects.
+    auto find(std::string_view word, std::size_t index, std::size_t quantity, std::vector<std::uint32_t> &results)
+        const -> std::size_t;
+
+    /// @brief Sorts the keywords registered so far, if it was not done already.
+    void build() const;
+
+    /// @brief Removes all the keywords.
+    void clear();
+
+    /// @brief Provides the number of keywords.
+    /// @return the number of keywords.
+    auto size() const -> std::size_t;
+};
+
+} // namespace interpreter
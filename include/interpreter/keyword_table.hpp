@@ -0,0 +1,107 @@
+/// @file keyword_table.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a table of keywords, matched against an argument all at once.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "argument.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief A table of keywords, which finds all the keywords abbreviated by an argument in a single sweep.
+///
+/// @details The keywords are packed in blocks of `lanes` keywords, and inside
+/// a block the first `width` characters are stored column by column: the first
+/// character of every keyword, then the second one, and so on. Matching a word
+/// then compares one of its characters with a whole column at a time, with
+/// AVX2 when the processor supports it, which is checked once at runtime, with
+/// SSE2 otherwise, or one keyword at a time when neither is available, see
+/// set_implementation(). Only the characters of the longest words, beyond
+/// `width`, are compared one keyword at a time. A lowercase copy
+/// of the columns is kept as well, for the case-insensitive matching.
+class KeywordTable
+{
+public:
+    /// @brief The number of characters of each keyword compared all at once.
+    static constexpr std::size_t width = 16;
+    /// @brief The number of keywords in a block.
+    static constexpr std::size_t lanes = 32;
+
+private:
+    /// The keywords, as they were inserted.
+    std::vector<std::string> keywords;
+    /// The first characters of the keywords, column by column, a block after the other.
+    std::vector<char> columns;
+    /// The lowercase copy of the columns.
+    std::vector<char> folded_columns;
+
+public:
+    /// @brief Constructor.
+    KeywordTable() = default;
+
+    /// @brief Constructor.
+    /// @param _keywords the keywords.
+    explicit KeywordTable(const std::vector<std::string> &_keywords);
+
+    /// @brief Adds a keyword at the end of the table.
+    /// @param keyword the keyword.
+    /// @return the position of the keyword.
+    auto insert(std::string_view keyword) -> std::uint32_t;
+
+    /// @brief Finds the keywords abbreviated by the argument, as Argument::is_abbreviation_of() does.
+    /// @param argument the argument, whose content is matched.
+    /// @param results where the positions of the matching keywords are stored, in order, it is cleared first.
+    /// @param sensitive enables case-sensitive check.
+    /// @param min_length the minimum number of characters for the abbreviation.
+    /// @return the number of matching keywords.
+    auto match(
+        const Argument &argument,
+        std::vector<std::uint32_t> &results,
+        bool sensitive         = false,
+        std::size_t min_length = 1) const -> std::size_t;
+
+    /// @brief Finds the keywords abbreviated by the word.
+    /// @param word the word.
+    /// @param results where the positions of the matching keywords are stored, in order, it is cleared first.
+    /// @param sensitive enables case-sensitive check.
+    /// @param min_length the minimum number of characters for the abbreviation.
+    /// @return the number of matching keywords.
+    auto match(
+        std::string_view word,
+        std::vector<std::uint32_t> &results,
+        bool sensitive         = false,
+        std::size_t min_length = 1) const -> std::size_t;
+
+    /// @brief Provides the name of the implementation chosen for this processor.
+    /// @return "avx2", "sse2" or "scalar".
+    static auto get_implementation() -> const char *;
+
+    /// @brief Forces the implementation, used to test and compare them.
+    /// @details It is not thread-safe, and must be called before matching.
+    /// @param name "avx2", "sse2" or "scalar".
+    /// @return true if the implementation is supported by this processor, false otherwise.
+    static auto set_implementation(std::string_view name) -> bool;
+
+    /// @brief Provides a keyword.
+    /// @param position the position of the keyword.
+    /// @return the keyword.
+    auto get_keyword(std::size_t position) const -> const std::string &;
+
+    /// @brief Removes all the keywords.
+    void clear();
+
+    /// @brief Provides the number of keywords.
+    /// @return the number of keywords.
+    auto size() const -> std::size_t;
+};
+
+} // namespace interpreter
@@ -0,0 +1,97 @@
+/// @file line_assembler.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the assembler which turns the bytes read from a socket into lines.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief Assembles the bytes received by a session into complete lines.
+///
+/// @details The bytes are read straight into the buffer of the assembler,
+/// see prepare() and commit(), and are cleaned in place as they arrive:
+/// carriage returns and NUL characters are dropped, a backspace removes the
+/// previous character of the line, and the telnet commands (IAC sequences,
+/// including the subnegotiations) are removed, even when they are split
+/// between two reads. The complete lines are then handed out as views of the
+/// buffer, so they reach the parser without being copied again; a single read
+/// can hold several lines, which can be parsed together by a ParseBatch. A
+/// line which does not fit inside the buffer is handed out in pieces.
+class LineAssembler
+{
+private:
+    /// @brief The state of the telnet decoder.
+    enum class State : std::uint8_t {
+        data,           ///< Plain text.
+        command,        ///< After an IAC.
+        option,         ///< After an IAC WILL, WONT, DO or DONT, waiting for the option.
+        subnegotiation, ///< Inside an IAC SB, waiting for the IAC SE.
+        subcommand,     ///< After an IAC inside a subnegotiation.
+    };
+
+    /// The buffer.
+    std::vector<char> buffer;
+    /// The first byte not handed out yet.
+    std::size_t begin;
+    /// The end of the cleaned bytes.
+    std::size_t end;
+    /// The start of the line being assembled, which a backspace cannot cross.
+    std::size_t line_start;
+    /// The cleaned bytes already searched for the end of the line.
+    std::size_t scanned;
+    /// The state of the telnet decoder.
+    State state;
+
+public:
+    /// @brief Constructor.
+    /// @param capacity the size of the buffer, i.e., the longest line handed out in one piece.
+    explicit LineAssembler(std::size_t capacity = 4096);
+
+    /// @brief Makes room for the next read.
+    /// @details The lines handed out before are no longer valid.
+    /// @return where the bytes must be read, up to available() of them.
+    auto prepare() -> char *;
+
+    /// @brief Provides the number of bytes which can be read after prepare().
+    /// @return the number of bytes.
+    auto available() const -> std::size_t;
+
+    /// @brief Cleans the bytes read after prepare().
+    /// @param count the number of bytes read, at most available().
+    void commit(std::size_t count);
+
+    /// @brief Copies the bytes inside the buffer, and cleans them.
+    /// @details The lines handed out before are no longer valid. When the
+    /// buffer is full, the lines must be handed out before appending the rest.
+    /// @param bytes the bytes.
+    /// @return the number of bytes copied.
+    auto append(std::string_view bytes) -> std::size_t;
+
+    /// @brief Hands out the next complete line, without the line terminator.
+    /// @param line where the line is stored, valid until the next call to prepare(), append() or clear().
+    /// @return true if there was a complete line.
+    auto next_line(std::string_view &line) -> bool;
+
+    /// @brief Hands out all the complete lines.
+    /// @param lines where the lines are stored, it is cleared first.
+    /// @return the number of lines.
+    auto next_lines(std::vector<std::string_view> &lines) -> std::size_t;
+
+    /// @brief Provides the number of bytes waiting for the end of their line.
+    /// @return the number of bytes.
+    auto size() const -> std::size_t;
+
+    /// @brief Drops the pending bytes, and resets the telnet decoder.
+    void clear();
+};
+
+} // namespace interpreter
@@ -0,0 +1,67 @@
+/// @file option_set.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the options an argument can be mapped to.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "prefix_trie.hpp"
+
+namespace interpreter
+{
+
+/// @brief Represents a selectable option with associated names.
+///
+/// @details Each option has a unique identifier and a list of names (aliases)
+/// that can be used to reference it. This structure is used to map input
+/// arguments to their corresponding options based on string comparisons.
+struct Option {
+    unsigned option;                ///< Unique identifier for the option.
+    std::vector<std::string> names; ///< List of names or aliases for the option.
+};
+
+/// @brief Associates a single name to an option, it can be used inside `constexpr` tables.
+struct OptionName {
+    unsigned option;  ///< Unique identifier for the option.
+    const char *name; ///< The name, or alias, of the option.
+};
+
+/// @brief A set of options, compiled once, to which arguments can be mapped.
+///
+/// @details The names are case-folded and indexed together with their
+/// abbreviations when the set is built, so mapping an argument is a single
+/// lookup. When the same abbreviation fits several names, the name typed in
+/// full wins, and otherwise the first option in the list.
+class OptionSet
+{
+private:
+    /// The index of the names, and their abbreviations.
+    PrefixTrie index;
+
+public:
+    /// @brief Constructor.
+    /// @param options the list of options.
+    /// @param min_length the minimum length of the abbreviations, npos if the names must be typed in full.
+    explicit OptionSet(const std::vector<Option> &options, std::size_t min_length = std::string::npos);
+
+    /// @brief Constructor, which reads the names from a table.
+    /// @param names the table of names.
+    /// @param min_length the minimum length of the abbreviations, npos if the names must be typed in full.
+    template <std::size_t N>
+    explicit OptionSet(const OptionName (&names)[N], std::size_t min_length = std::string::npos)
+    {
+        for (const OptionName &name : names) {
+            index.insert(name.name, name.option, min_length);
+        }
+        index.build();
+    }
+
+    /// @brief Maps a word to an option.
+    /// @param word the word.
+    /// @return the option, 0 if the word does not match any of the names.
+    auto find(std::string_view word) const -> unsigned;
+};
+
+} // namespace interpreter
@@ -0,0 +1,94 @@
+/// @file parse_cache.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a cache of the parsed input lines.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "interpreter.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace interpreter
+{
+
+/// @brief Remembers how the most frequent input lines were parsed.
+///
+/// @details Players, and bots even more, type the same few lines over and
+/// over, e.g., `n`, `look` or `kill rat`. The cache remembers where the words
+/// of a line are, and their prefixes, so that parsing the line again only
+/// copies them into the interpreter, without tokenizing it or evaluating the
+/// prefixes. The lines are spread over several shards, each one with its own
+/// lock, and each shard evicts its lines with the CLOCK policy: a line used
+/// since the hand last passed by gets a second chance. The lines remember the
+/// version of the configuration they were parsed with, so they are parsed
+/// again as soon as a different snapshot is installed.
+class ParseCache
+{
+private:
+    /// @brief A line, and the position of its words.
+    struct Entry {
+        std::string line;                     ///< The line.
+        std::vector<Interpreter::Word> words; ///< The words of the line.
+        std::uint64_t version;                ///< The version of the configuration used to parse it.
+        bool ignore;                          ///< If the ignored words were removed.
+        bool referenced;                      ///< If the line was used since the hand last passed by.
+    };
+
+    /// @brief A shard of the cache.
+    struct Shard {
+        std::mutex mutex;                                             ///< Protects the shard.
+        std::vector<Entry> entries;                                   ///< The lines.
+        std::unordered_map<std::string_view, std::uint32_t> index[2]; ///< The lines, without and with ignoring.
+        std::size_t hand = 0;                                         ///< The next line considered for eviction.
+        std::atomic<std::uint64_t> hits{0};                           ///< The number of lines found.
+        std::atomic<std::uint64_t> misses{0};                         ///< The number of lines parsed.
+    };
+
+    /// The shards.
+    std::vector<std::unique_ptr<Shard>> shards;
+    /// The number of lines kept by each shard.
+    std::size_t shard_capacity;
+
+public:
+    /// @brief Constructor.
+    /// @param capacity the number of lines kept, at least one per shard.
+    /// @param _shards the number of shards, which can be used at the same time by different threads.
+    explicit ParseCache(std::size_t capacity = 4096, std::size_t _shards = 16);
+
+    /// @brief Parses the input, or loads it from the cache.
+    /// @details The interpreter parses with its own configuration, if it was
+    /// given one, otherwise with the current snapshot, as Interpreter::parse()
+    /// does.
+    /// @param args where the input is parsed.
+    /// @param input the input.
+    /// @param ignore if we should ignore the list of ignored words.
+    /// @return true if the input was found inside the cache.
+    auto parse(Interpreter &args, std::string_view input, bool ignore) -> bool;
+
+    /// @brief Removes all the lines, the counters are kept.
+    void clear();
+
+    /// @brief Provides the number of inputs found inside the cache.
+    /// @return the number of hits.
+    auto get_hits() const -> std::uint64_t;
+
+    /// @brief Provides the number of inputs which had to be parsed.
+    /// @return the number of misses.
+    auto get_misses() const -> std::uint64_t;
+
+    /// @brief Provides the number of lines inside the cache.
+    /// @return the number of lines.
+    auto size() const -> std::size_t;
+
+    /// @brief Provides the number of lines the cache can keep.
+    /// @return the capacity.
+    auto capacity() const -> std::size_t;
+};
+
+} // namespace interpreter
@@ -0,0 +1,122 @@
+/// @file pipeline.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the pipeline, which parses the input of a tick on many threads.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "interpreter.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace interpreter
+{
+
+/// @brief Parses the input lines of a tick on a fixed pool of workers.
+///
+/// @details The lines are split into chunks, and every worker starts from its
+/// own contiguous share of them. A worker which runs out of chunks steals them
+/// from the back of the queues of the others, so a few long lines do not keep
+/// the whole tick waiting. The calling thread takes part as the first worker.
+/// Every line is parsed into the interpreter with the same position, which
+/// is reused from one tick to the next, so the results come back in the
+/// order of the input without any reordering. All the lines of a tick are
+/// parsed with the snapshot which is current when the tick starts, so the
+/// workers never touch the global configuration, except for the interpreters
+/// which were given their own configuration with Interpreter::set_config().
+class Pipeline
+{
+private:
+    /// @brief A range of lines.
+    struct Range {
+        std::size_t begin; ///< The first line.
+        std::size_t end;   ///< The line after the last one.
+    };
+
+    /// @brief The chunks of a worker, taken from the front by the owner and from the back by the thieves.
+    struct Queue {
+        std::mutex mutex;          ///< Protects the queue.
+        std::vector<Range> ranges; ///< The chunks.
+        std::size_t head = 0;      ///< The first chunk not taken yet.
+    };
+
+    /// The queue of each worker, the first one belongs to the calling thread.
+    std::vector<std::unique_ptr<Queue>> queues;
+    /// The threads of the other workers.
+    std::vector<std::thread> threads;
+    /// Protects the state of the tick.
+    std::mutex mutex;
+    /// Wakes up the workers when a tick starts.
+    std::condition_variable wake;
+    /// Wakes up the calling thread when the workers are done.
+    std::condition_variable done;
+    /// Incremented at every tick.
+    std::uint64_t generation = 0;
+    /// The number of threads still working on the tick.
+    std::size_t pending = 0;
+    /// If the threads must stop.
+    bool stopping = false;
+    /// The lines of the tick.
+    const std::string_view *lines = nullptr;
+    /// Where the lines are parsed.
+    Interpreter *results = nullptr;
+    /// If the ignored words must be removed.
+    bool ignore = false;
+    /// The configuration used by the tick.
+    std::shared_ptr<const Config> configuration;
+
+public:
+    /// @brief Constructor.
+    /// @param workers the number of workers, including the calling thread, 0 to use one per core.
+    explicit Pipeline(std::size_t workers = 0);
+
+    /// @brief Destructor, which stops the workers.
+    ~Pipeline();
+
+    Pipeline(const Pipeline &)                     = delete;
+    auto operator=(const Pipeline &) -> Pipeline & = delete;
+
+    /// @brief Parses the lines, and waits until all of them are done.
+    /// @param _lines the lines, they must stay valid during the call.
+    /// @param count the number of lines.
+    /// @param _ignore if we should ignore the list of ignored words.
+    /// @param _results where each line is parsed, resized to the number of lines.
+    void parse(const std::string_view *_lines, std::size_t count, bool _ignore, std::vector<Interpreter> &_results);
+
+    /// @brief Parses the lines, and waits until all of them are done.
+    /// @param _lines the lines.
+    /// @param _ignore if we should ignore the list of ignored words.
+    /// @param _results where each line is parsed, resized to the number of lines.
+    void parse(const std::vector<std::string> &_lines, bool _ignore, std::vector<Interpreter> &_results);
+
+    /// @brief Provides the number of workers, including the calling thread.
+    /// @return the number of workers.
+    auto size() const -> std::size_t;
+
+private:
+    /// @brief The loop of the threads, which wait for a tick and work on it.
+    /// @param worker the worker.
+    void run(std::size_t worker);
+
+    /// @brief Parses the lines of the current tick, until there are none left.
+    /// @param worker the worker.
+    void work(std::size_t worker);
+
+    /// @brief Takes a chunk from the front of the queue of the worker.
+    /// @param worker the worker.
+    /// @param range where the chunk is stored.
+    /// @return true if there was one.
+    auto pop(std::size_t worker, Range &range) -> bool;
+
+    /// @brief Takes a chunk from the back of the queue of another worker.
+    /// @param worker the worker which steals.
+    /// @param range where the chunk is stored.
+    /// @return true if there was one.
+    auto steal(std::size_t worker, Range &range) -> bool;
+};
+
+} // namespace interpreter
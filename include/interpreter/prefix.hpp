@@ -0,0 +1,43 @@
+/// @file prefix.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the evaluation of the index and quantity prefixes.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+namespace interpreter
+{
+
+/// @brief The prefixes of a word, i.e., its `<index>.`, `<quantity>*` or `all.`.
+struct Prefix {
+    /// @brief The flags of the prefixes found inside a word.
+    enum : unsigned char {
+        FLAG_ALL      = (1U << 1U), ///< The `all.` prefix was specified.
+        FLAG_QUANTITY = (1U << 2U), ///< The `<quantity>*` postfix was specified.
+        FLAG_INDEX    = (1U << 3U)  ///< The `<index>.` postfix was specified.
+    };
+
+    std::size_t content_begin;  ///< The position of the content inside the word.
+    std::size_t content_length; ///< The length of the content.
+    std::size_t index;          ///< The provided index, 1 by default.
+    std::size_t quantity;       ///< The provided quantity, 1 by default.
+    unsigned flags;             ///< The prefixes which were found.
+
+    /// @brief Evaluates the prefixes of a word.
+    /// @param word the word.
+    /// @param index_pos the position of the first index symbol inside the word, or npos.
+    /// @param quantity_pos the position of the first quantity symbol inside the word, or npos.
+    /// @param config the configuration.
+    /// @return the prefixes.
+    static auto evaluate(std::string_view word, std::size_t index_pos, std::size_t quantity_pos, const Config &config)
+        -> Prefix;
+};
+
+} // namespace interpreter
@@ -0,0 +1,107 @@
+/// @file prefix_trie.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a trie which resolves words and their abbreviations.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief Maps case-insensitive keys, and their abbreviations, to values.
+///
+/// @details Every key is registered with the minimum length of its
+/// abbreviations and a priority. When a prefix is shared by several keys, the
+/// winner is decided when the keys are inserted: a key typed in full always
+/// wins, otherwise the key with the highest priority wins, and on equal
+/// priority the one inserted first. Once all the keys are inserted the trie is
+/// laid out as a flat array, where the children of a node are contiguous and
+/// sorted, so that resolving a word only walks its characters. This happens on
+/// the first find() after an insertion, or when build() is called, which must
+/// be done before sharing the trie between threads.
+class PrefixTrie
+{
+public:
+    /// @brief The value returned when nothing matches.
+    static constexpr std::uint32_t none = UINT32_MAX;
+
+private:
+    /// @brief A candidate for a node.
+    struct Candidate {
+        std::uint32_t value; ///< The value.
+        int priority;        ///< The priority of the key.
+        std::uint32_t order; ///< The order in which the key was inserted.
+    };
+
+    /// @brief A node used while inserting the keys.
+    struct BuildNode {
+        char symbol;                ///< The character which leads to the node.
+        std::uint32_t first_child;  ///< The first child, or none.
+        std::uint32_t next_sibling; ///< The next sibling, or none.
+        Candidate exact;            ///< The key ending exactly at this node.
+        Candidate abbreviation;     ///< The best key abbreviated by this node.
+    };
+
+    /// @brief A node of the flat trie.
+    struct Node {
+        char symbol;               ///< The character which leads to the node.
+        std::uint32_t first_child; ///< The position of the first child.
+        std::uint32_t children;    ///< The number of children.
+        std::uint32_t value;       ///< The value resolved for this prefix, or none.
+    };
+
+    /// The nodes used while inserting, the first one is the root.
+    std::vector<BuildNode> building;
+    /// The flat trie, the first node is the root.
+    mutable std::vector<Node> nodes;
+    /// If keys were inserted since the trie was last laid out.
+    mutable bool dirty;
+    /// The number of keys inserted so far.
+    std::uint32_t count;
+
+public:
+    /// @brief Constructor.
+    PrefixTrie();
+
+    /// @brief Inserts a key, and resolves the prefixes it shares with the other keys.
+    /// @param key the key, compared without considering the case.
+    /// @param value the value associated with the key.
+    /// @param min_length the minimum length of the abbreviations, npos if the key must be typed in full.
+    /// @param priority the priority of the key over the other keys sharing an abbreviation.
+    void insert(std::string_view key, std::uint32_t value, std::size_t min_length = std::string::npos, int priority = 0);
+
+    /// @brief Lays out the keys inserted so far, if it was not done already.
+    void build() const;
+
+    /// @brief Resolves a word.
+    /// @param word the word, compared without considering the case.
+    /// @return the value of the matching key, or none.
+    auto find(std::string_view word) const -> std::uint32_t;
+
+    /// @brief Removes all the keys.
+    void clear();
+
+    /// @brief Provides the number of keys.
+    /// @return the number of keys.
+    auto size() const -> std::size_t;
+
+private:
+    /// @brief Lays out the trie as a flat array.
+    void flatten() const;
+
+    /// @brief Checks if a candidate is better than the current one.
+    /// @param candidate the candidate.
+    /// @param current the current one.
+    /// @return true if the candidate wins.
+    static auto is_better(const Candidate &candidate, const Candidate &current) -> bool;
+};
+
+} // namespace interpreter
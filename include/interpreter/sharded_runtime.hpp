@@ -0,0 +1,206 @@
+/// @file sharded_runtime.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a runtime which runs the sessions on several shards, one per core.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include "parse_cache.hpp"
+#include "spsc_queue.hpp"
+
+#include <deque>
+#include <functional>
+#include <thread>
+
+namespace interpreter
+{
+
+/// @brief Runs the sessions on a fixed number of shards, each one on its own thread.
+///
+/// @details Every session is pinned to a shard, see shard_of(), and its
+/// commands are only ever executed by that shard. A shard owns everything it
+/// needs to execute them: an interpreter reused for all its commands, a
+/// snapshot of the configuration and a cache of the parsed lines, so the
+/// shards share nothing while executing commands. A shard reaches the
+/// sessions of another shard only through messages, e.g., a `tell` to a player
+/// on another shard, which travel over one single-producer single-consumer
+/// queue for each pair of shards. When such a queue is full, the messages wait
+/// inside the sending shard and are retried at the next iteration, so a shard
+/// never blocks waiting for another one.
+///
+/// Each shard runs its own loop, which calls the poller, where the shard reads
+/// its own input (e.g., from its own epoll instance) and executes it with
+/// Shard::execute(), and then delivers the messages sent to its sessions. The
+/// callbacks are called by all the shards at the same time, so they must only
+/// touch the state of the shard they are given.
+class ShardedRuntime
+{
+public:
+    /// @brief A message for a session.
+    struct Message {
+        std::uint32_t session; ///< The session.
+        std::string text;      ///< The text.
+    };
+
+    class Shard;
+
+    /// @brief Executes a parsed command for a session, and tells if the command was understood.
+    using Handler = std::function<bool(Shard &, std::uint32_t, Interpreter &)>;
+    /// @brief Receives a message for a session of the shard.
+    using Receiver = std::function<void(Shard &, std::uint32_t, std::string_view)>;
+    /// @brief Reads and executes the input of the shard, and tells if there was any.
+    using Poller = std::function<bool(Shard &)>;
+
+    /// @brief The state of a shard, used only by its own thread.
+    class Shard
+    {
+    private:
+        friend class ShardedRuntime;
+
+        /// The runtime.
+        ShardedRuntime *runtime;
+        /// The position of the shard.
+        std::size_t index;
+        /// The interpreter, reused for every command.
+        Interpreter args;
+        /// The snapshot of the configuration used by the shard.
+        std::shared_ptr<const Config> configuration;
+        /// The lines parsed by the shard.
+        ParseCache cache;
+        /// The messages which did not fit inside the queue towards each shard.
+        std::vector<std::deque<Message>> overflow;
+        /// The number of messages waiting inside the overflow.
+        std::size_t overflowing;
+        /// The number of commands executed.
+        std::atomic<std::uint64_t> executed;
+        /// The number of messages received by the sessions of the shard.
+        std::atomic<std::uint64_t> received;
+        /// The thread.
+        std::thread thread;
+
+    public:
+        /// @brief Constructor.
+        /// @param _runtime the runtime.
+        /// @param _index the position of the shard.
+        /// @param cache_capacity the number of lines kept by the cache of the shard.
+        Shard(ShardedRuntime &_runtime, std::size_t _index, std::size_t cache_capacity);
+
+        /// @brief Provides the position of the shard.
+        /// @return the position.
+        auto get_index() const -> std::size_t;
+
+        /// @brief Parses a line, with the cache of the shard, and passes it to the handler.
+        /// @param session the session which sent the line, which must belong to the shard.
+        /// @param line the line.
+        /// @param ignore if we should ignore the list of ignored words.
+        /// @return the result of the handler.
+        auto execute(std::uint32_t session, std::string_view line, bool ignore = false) -> bool;
+
+        /// @brief Sends a message to a session, of this shard or of another one.
+        /// @details The messages for the sessions of this shard are received
+        /// immediately, the other ones when their shard delivers them.
+        /// @param session the session.
+        /// @param text the text.
+        void send(std::uint32_t session, std::string text);
+
+        /// @brief Provides the configuration used by the shard.
+        /// @return the snapshot.
+        auto get_config() const -> const std::shared_ptr<const Config> &;
+
+        /// @brief Provides the cache of the parsed lines.
+        /// @return the cache.
+        auto get_cache() -> ParseCache &;
+
+        /// @brief Provides the number of commands executed so far.
+        /// @return the number of commands.
+        auto get_executed() const -> std::uint64_t;
+
+        /// @brief Provides the number of messages received so far.
+        /// @return the number of messages.
+        auto get_received() const -> std::uint64_t;
+
+    private:
+        /// @brief Follows the snapshot installed with config::install().
+        void refresh();
+
+        /// @brief Receives the messages sent by the other shards, and retries the ones which did not fit.
+        /// @return true if any message moved.
+        auto deliver() -> bool;
+
+        /// @brief Receives a message for a session of the shard.
+        /// @param session the session.
+        /// @param text the text.
+        void receive(std::uint32_t session, std::string_view text);
+
+        /// @brief The loop of the shard.
+        void run();
+    };
+
+private:
+    /// The shards.
+    std::vector<std::unique_ptr<Shard>> shards;
+    /// The queues between the shards, the one from `a` to `b` is at `a * size() + b`.
+    std::vector<std::unique_ptr<SpscQueue<Message>>> queues;
+    /// The handler of the commands.
+    Handler handler;
+    /// The receiver of the messages.
+    Receiver receiver;
+    /// The poller of the input.
+    Poller poller;
+    /// If the shards must stop.
+    std::atomic<bool> stopping;
+
+public:
+    /// @brief Constructor, which starts the shards.
+    /// @param count the number of shards, 0 to use one per core.
+    /// @param _handler executes the commands.
+    /// @param _receiver receives the messages.
+    /// @param _poller reads and executes the input of a shard.
+    /// @param queue_capacity the number of messages each queue between two shards can hold.
+    /// @param cache_capacity the number of lines kept by the cache of each shard.
+    ShardedRuntime(
+        std::size_t count,
+        Handler _handler,
+        Receiver _receiver,
+        Poller _poller,
+        std::size_t queue_capacity = 1024,
+        std::size_t cache_capacity = 1024);
+
+    /// @brief Destructor, which stops the shards.
+    ~ShardedRuntime();
+
+    ShardedRuntime(const ShardedRuntime &)                     = delete;
+    auto operator=(const ShardedRuntime &) -> ShardedRuntime & = delete;
+
+    /// @brief Stops the shards, and waits for them.
+    /// @details The messages still travelling between the shards are then
+    /// delivered by the calling thread, which calls the receiver on behalf of
+    /// their shard, since no shard is running anymore.
+    void stop();
+
+    /// @brief Provides the shard owning a session.
+    /// @param session the session.
+    /// @return the position of the shard.
+    auto shard_of(std::uint32_t session) const -> std::size_t;
+
+    /// @brief Provides a shard.
+    /// @param position the position of the shard.
+    /// @return the shard.
+    auto get_shard(std::size_t position) -> Shard &;
+
+    /// @brief Provides the number of shards.
+    /// @return the number of shards.
+    auto size() const -> std::size_t;
+
+    /// @brief Provides the number of commands executed by all the shards.
+    /// @return the number of commands.
+    auto get_executed() const -> std::uint64_t;
+
+    /// @brief Provides the number of messages received by all the shards.
+    /// @return the number of messages.
+    auto get_received() const -> std::uint64_t;
+};
+
+} // namespace interpreter
@@ -0,0 +1,116 @@
+/// @file spsc_queue.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a bounded lock-free queue, with a single producer and a single consumer.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief A bounded ring buffer, shared by exactly one producer thread and one consumer thread.
+///
+/// @details The producer only writes the tail and the consumer only writes
+/// the head, so neither of them locks or waits. Each side keeps a copy of the
+/// index of the other side, and reads the shared one again only when its copy
+/// says that the queue is full, or empty: most operations touch a single cache
+/// line. The two indices live on separate cache lines, so that the two threads
+/// do not keep stealing the same line from each other.
+/// @tparam T the type of the values, which are moved in and out of the queue.
+template <typename T>
+class SpscQueue
+{
+private:
+    /// The size of a cache line.
+    static constexpr std::size_t line = 64;
+
+    /// The slots, whose number is a power of two.
+    std::vector<T> slots;
+    /// The number of slots minus one.
+    std::size_t mask;
+    /// The next slot to read, written by the consumer.
+    alignas(line) std::atomic<std::size_t> head;
+    /// The copy of the tail kept by the consumer.
+    std::size_t tail_copy;
+    /// The next slot to write, written by the producer.
+    alignas(line) std::atomic<std::size_t> tail;
+    /// The copy of the head kept by the producer.
+    std::size_t head_copy;
+
+public:
+    /// @brief Constructor.
+    /// @param capacity the number of values the queue can hold, rounded up to a power of two.
+    explicit SpscQueue(std::size_t capacity = 1024)
+        : slots()
+        , mask(0)
+        , head(0)
+        , tail_copy(0)
+        , tail(0)
+        , head_copy(0)
+    {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1U;
+        }
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue &)                     = delete;
+    auto operator=(const SpscQueue &) -> SpscQueue & = delete;
+
+    /// @brief Adds a value at the back of the queue, only from the producer thread.
+    /// @param value the value, which is moved only if there is room for it.
+    /// @return false if the queue is full.
+    auto try_push(T &&value) -> bool
+    {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        if ((position - head_copy) > mask) {
+            head_copy = head.load(std::memory_order_acquire);
+            if ((position - head_copy) > mask) {
+                return false;
+            }
+        }
+        slots[position & mask] = std::move(value);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Takes the value at the front of the queue, only from the consumer thread.
+    /// @param value where the value is moved.
+    /// @return false if the queue is empty.
+    auto try_pop(T &value) -> bool
+    {
+        std::size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail_copy) {
+            tail_copy = tail.load(std::memory_order_acquire);
+            if (position == tail_copy) {
+                return false;
+            }
+        }
+        value = std::move(slots[position & mask]);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Provides the number of values inside the queue.
+    /// @details It is exact only when neither thread is using the queue.
+    /// @return the number of values.
+    auto size() const -> std::size_t
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    /// @brief Provides the number of values the queue can hold.
+    /// @return the capacity.
+    auto capacity() const -> std::size_t { return mask + 1; }
+};
+
+} // namespace interpreter
@@ -0,0 +1,173 @@
+/// @file tokenizer.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines the tokenizer which splits the input into words.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace interpreter
+{
+
+/// @brief A word found by the tokenizer.
+struct Token {
+    std::size_t begin;        ///< The position of the word inside the text.
+    std::size_t length;       ///< The length of the word.
+    std::size_t index_pos;    ///< The position of the first index symbol inside the word, or npos.
+    std::size_t quantity_pos; ///< The position of the first quantity symbol inside the word, or npos.
+};
+
+/// @brief Splits a text into words, and locates the prefix symbols inside them.
+///
+/// @details The text is classified in blocks of 64 bytes, producing one bit
+/// per byte for whitespace (space, tabs, carriage returns and new lines), for
+/// the index symbols and for the quantity symbols. The classification uses
+/// AVX2 or SSE2 when the processor supports them, which is checked once at
+/// runtime, and a scalar loop otherwise. Words and symbol positions are then
+/// extracted from the bits, so the text is scanned a single time.
+class Tokenizer
+{
+public:
+    /// @brief The bits of a block of text.
+    struct Masks {
+        std::uint64_t space;    ///< Bits set for whitespace.
+        std::uint64_t index;    ///< Bits set for the index symbols.
+        std::uint64_t quantity; ///< Bits set for the quantity symbols.
+    };
+
+    /// @brief The size of the blocks classified at once.
+    static constexpr std::size_t block_size = 64;
+
+private:
+    /// The symbols used to specify an index.
+    std::string_view index_symbols;
+    /// The symbols used to specify a quantity.
+    std::string_view quantity_symbols;
+
+public:
+    /// @brief Constructor.
+    /// @param _index_symbols the symbols used to specify an index, they must outlive the tokenizer.
+    /// @param _quantity_symbols the symbols used to specify a quantity, they must outlive the tokenizer.
+    Tokenizer(std::string_view _index_symbols, std::string_view _quantity_symbols);
+
+    /// @brief Classifies a block of text.
+    /// @param block the block, with at least `length` readable bytes.
+    /// @param length the number of bytes, at most block_size.
+    /// @param masks where the bits are stored, bits past `length` are zero.
+    void classify(const char *block, std::size_t length, Masks &masks) const;
+
+    /// @brief Splits the text into words.
+    /// @param text the text.
+    /// @param emit function called with every Token, in order, if it returns a bool, false stops the tokenization.
+    template <typename Fun>
+    void tokenize(std::string_view text, Fun emit) const
+    {
+        Masks masks{};
+        bool inside = false;
+        Token token{0, 0, std::string_view::npos, std::string_view::npos};
+        for (std::size_t base = 0; base < text.length(); base += block_size) {
+            std::size_t length = (text.length() - base) < block_size ? (text.length() - base) : block_size;
+            this->classify(text.data() + base, length, masks);
+            std::size_t pos = 0;
+            while (pos < length) {
+                if (!inside) {
+                    // Look for the start of the next word.
+                    std::uint64_t start = ~masks.space & Tokenizer::from(pos) & Tokenizer::below(length);
+                    if (start == 0) {
+                        break;
+                    }
+                    pos    = Tokenizer::lowest(start);
+                    inside = true;
+                    token  = Token{base + pos, 0, std::string_view::npos, std::string_view::npos};
+                }
+                // Look for the end of the word.
+                std::uint64_t stop = masks.space & Tokenizer::from(pos);
+                std::size_t end    = (stop != 0) ? Tokenizer::lowest(stop) : length;
+                std::uint64_t span = Tokenizer::from(pos) & Tokenizer::below(end);
+                if ((token.index_pos == std::string_view::npos) && ((masks.index & span) != 0)) {
+                    token.index_pos = base + Tokenizer::lowest(masks.index & span) - token.begin;
+                }
+                if ((token.quantity_pos == std::string_view::npos) && ((masks.quantity & span) != 0)) {
+                    token.quantity_pos = base + Tokenizer::lowest(masks.quantity & span) - token.begin;
+                }
+                if (stop == 0) {
+                    break;
+                }
+                token.length = base + end - token.begin;
+                if (!Tokenizer::call(emit, token)) {
+                    return;
+                }
+                inside = false;
+                pos    = end;
+            }
+        }
+        if (inside) {
+            token.length = text.length() - token.begin;
+            Tokenizer::call(emit, token);
+        }
+    }
+
+    /// @brief Provides the name of the implementation chosen for this processor.
+    /// @return "avx2", "sse2" or "scalar".
+    static auto get_implementation() -> const char *;
+
+    /// @brief Forces the implementation, used to test and compare them.
+    /// @details It is not thread-safe, and must be called before parsing.
+    /// @param name "avx2", "sse2" or "scalar".
+    /// @return true if the implementation is supported by this processor, false otherwise.
+    static auto set_implementation(std::string_view name) -> bool;
+
+private:
+    /// @brief Calls the function with the token.
+    /// @param emit the function.
+    /// @param token the token.
+    /// @return false if the tokenization must stop.
+    template <typename Fun>
+    static auto call(Fun &emit, const Token &token) -> bool
+    {
+        if constexpr (std::is_same_v<decltype(emit(token)), bool>) {
+            return emit(token);
+        } else {
+            emit(token);
+            return true;
+        }
+    }
+
+    /// @brief Provides the bits from the given position onward.
+    /// @param pos the position.
+    /// @return the mask.
+    static auto from(std::size_t pos) -> std::uint64_t { return (pos >= 64) ? 0 : (~std::uint64_t(0) << pos); }
+
+    /// @brief Provides the bits below the given position.
+    /// @param pos the position.
+    /// @return the mask.
+    static auto below(std::size_t pos) -> std::uint64_t
+    {
+        return (pos >= 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << pos) - 1);
+    }
+
+    /// @brief Provides the position of the lowest set bit.
+    /// @param mask the mask, must not be zero.
+    /// @return the position.
+    static auto lowest(std::uint64_t mask) -> std::size_t
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+        std::size_t pos = 0;
+        while ((mask & 1U) == 0) {
+            mask >>= 1U;
+            ++pos;
+        }
+        return pos;
+#endif
+    }
+};
+
+} // namespace interpreter
@@ -0,0 +1,79 @@
+/// @file word_set.hpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Defines a set of words with case-insensitive lookup.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace interpreter
+{
+
+/// @brief A set of words, compared without considering the case.
+///
+/// @details The words are case-folded and stored contiguously, and indexed by
+/// a hash table whose seed is chosen when the set is built so that no two
+/// words share a slot (i.e., a perfect hash). Checking a word therefore costs
+/// a single hash, computed while folding the word, and a single comparison.
+/// Words whose length does not appear in the set are rejected without hashing.
+class WordSet
+{
+private:
+    /// @brief A slot of the table.
+    struct Slot {
+        std::uint32_t offset; ///< The position of the word inside the text.
+        std::uint32_t length; ///< The length of the word, 0 if the slot is empty.
+    };
+
+    /// The folded words, one after the other.
+    std::string text;
+    /// The table.
+    std::vector<Slot> slots;
+    /// The seed of the hash function.
+    std::uint64_t seed;
+    /// One bit for every length of word in the set, the last bit stands for longer words.
+    std::uint64_t lengths;
+
+public:
+    /// @brief Constructor.
+    WordSet();
+
+    /// @brief Constructor.
+    /// @param words the words.
+    explicit WordSet(const std::vector<std::string> &words);
+
+    /// @brief Rebuilds the set with the given words.
+    /// @param words the words.
+    void assign(const std::vector<std::string> &words);
+
+    /// @brief Checks if the word is in the set, without considering the case.
+    /// @param word the word.
+    /// @param folded if the word is already lowercase, so that it is not folded again.
+    /// @return true if it is in the set, false otherwise.
+    auto contains(std::string_view word, bool folded = false) const -> bool;
+
+    /// @brief Checks if the set is empty.
+    /// @return true if the set is empty.
+    auto empty() const -> bool;
+
+private:
+    /// @brief Hashes the word, without considering the case.
+    /// @param word the word.
+    /// @param _seed the seed.
+    /// @param folded if the word is already lowercase.
+    /// @return the hash.
+    static auto hash(std::string_view word, std::uint64_t _seed, bool folded) -> std::uint64_t;
+
+    /// @brief Provides the bit associated with the length of a word.
+    /// @param length the length.
+    /// @return the bit.
+    static auto length_bit(std::size_t length) -> std::uint64_t;
+};
+
+} // namespace interpreter
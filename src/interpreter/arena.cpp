@@ -0,0 +1,85 @@
+/// @file arena.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the bump arena.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/arena.hpp"
+
+#include <cstdint>
+
+namespace interpreter
+{
+
+Arena::Arena(std::size_t _block_size)
+    : current(0)
+    , offset(0)
+    , block_size(_block_size)
+    , used(0)
+{
+    // Nothing to do.
+}
+
+Arena::Arena(void *buffer, std::size_t size, std::size_t _block_size)
+    : current(0)
+    , offset(0)
+    , block_size(_block_size)
+    , used(0)
+{
+    blocks.push_back(Block{static_cast<unsigned char *>(buffer), size, false});
+}
+
+Arena::~Arena()
+{
+    for (auto &block : blocks) {
+        if (block.owned) {
+            ::operator delete(block.data);
+        }
+    }
+}
+
+auto Arena::allocate(std::size_t size, std::size_t alignment) -> void *
+{
+    // Look for a block with enough space, starting from the current one.
+    while (current < blocks.size()) {
+        Block &block      = blocks[current];
+        auto address      = reinterpret_cast<std::uintptr_t>(block.data) + offset;
+        std::size_t align = (alignment - (address % alignment)) % alignment;
+        if ((offset + align + size) <= block.size) {
+            void *result = block.data + offset + align;
+            offset += align + size;
+            used += size;
+            return result;
+        }
+        // Move to the next block, which was kept from a previous tick.
+        ++current;
+        offset = 0;
+    }
+    // We need a new block, big enough for the request.
+    std::size_t size_of_block = (size + alignment > block_size) ? (size + alignment) : block_size;
+    blocks.push_back(Block{static_cast<unsigned char *>(::operator new(size_of_block)), size_of_block, true});
+    current = blocks.size() - 1;
+    offset  = 0;
+    return this->allocate(size, alignment);
+}
+
+void Arena::reset()
+{
+    current = 0;
+    offset  = 0;
+    used    = 0;
+}
+
+auto Arena::get_used() const -> std::size_t { return used; }
+
+auto Arena::get_capacity() const -> std::size_t
+{
+    std::size_t capacity = 0;
+    for (const auto &block : blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+} // namespace interpreter
@@ -7,54 +7,330 @@
 
 #include "interpreter/argument.hpp"
 
-enum : unsigned char {
-    FLAG_ALL      = (1U << 1U), ///< The `all.` prefix was specified.
-    FLAG_QUANTITY = (1U << 2U), ///< The `<quantity>*` postfix was specified.
-    FLAG_INDEX    = (1U << 3U)  ///< The `<index>.` postfix was specified.
-};
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+/// @brief Narrows an offset, or a number, to the size stored inside the arguments.
+/// @param value the value.
+/// @return the value, saturated to UINT32_MAX.
+inline auto narrow(std::size_t value) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(std::min<std::size_t>(value, UINT32_MAX));
+}
+
+/// @brief Turns an ASCII character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+/// @brief Compares a text with a string, without considering the case.
+/// @param text the text, which is already lowercase when `folded` is true.
+/// @param string the string, of at least the same length.
+/// @param folded if the text is already lowercase.
+/// @return true if they are equal.
+inline auto same(std::string_view text, std::string_view string, bool folded) -> bool
+{
+    for (std::size_t it = 0; it < text.length(); ++it) {
+        if ((folded ? text[it] : fold(text[it])) != fold(string[it])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
 
 namespace interpreter
 {
 
 Argument::Argument(const std::string &_original)
-    : original(_original)
-    , content(_original)
+    : source(nullptr)
+    , configuration(nullptr)
+    , position(0)
+    , original_begin(0)
+    , original_length(narrow(_original.length()))
+    , content_begin(0)
+    , content_length(narrow(_original.length()))
+    , index(1)
+    , quantity(1)
+    , prefix(0)
+    , allocated(false)
+{
+    this->store(_original);
+    // Evaluate all the prefix.
+    this->evaluate_all_prefix(
+        this->get_original_view().find_first_of(this->get_config().get_symbols_index()),
+        this->get_original_view().find_first_of(this->get_config().get_symbols_multiplier()));
+}
+
+Argument::Argument(const char *_source, std::size_t _begin, std::size_t _length, const char *_folded)
+    : source(_source)
+    , configuration(nullptr)
+    , position(narrow(_begin))
+    , original_begin(narrow(_begin))
+    , original_length(narrow(_length))
+    , content_begin(narrow(_begin))
+    , content_length(narrow(_length))
     , index(1)
     , quantity(1)
     , prefix(0)
+    , allocated(false)
+    , folded(_folded)
 {
     // Evaluate all the prefix.
-    this->evaluate_all_prefix();
+    this->evaluate_all_prefix(
+        this->get_original_view().find_first_of(this->get_config().get_symbols_index()),
+        this->get_original_view().find_first_of(this->get_config().get_symbols_multiplier()));
+}
+
+Argument::Argument(const char *_source, const Token &token, const Config &config, const char *_folded)
+    : source(_source)
+    , configuration(&config)
+    , position(narrow(token.begin))
+    , original_begin(narrow(token.begin))
+    , original_length(narrow(token.length))
+    , content_begin(narrow(token.begin))
+    , content_length(narrow(token.length))
+    , index(narrow(token.index_pos))
+    , quantity(narrow(token.quantity_pos))
+    , prefix(0)
+    , allocated(false)
+    , folded(_folded)
+{
+    // Words without symbols have no prefix, the others are evaluated when first needed.
+    if ((token.index_pos == std::string_view::npos) && (token.quantity_pos == std::string_view::npos)) {
+        index    = 1;
+        quantity = 1;
+    } else {
+        prefix = unresolved;
+    }
+}
+
+Argument::Argument(
+    const char *_source,
+    std::size_t _begin,
+    std::size_t _length,
+    const Prefix &_prefix,
+    const Config &config,
+    const char *_folded)
+    : source(_source)
+    , configuration(&config)
+    , position(narrow(_begin))
+    , original_begin(narrow(_begin))
+    , original_length(narrow(_length))
+    , content_begin(narrow(_begin + _prefix.content_begin))
+    , content_length(narrow(_prefix.content_length))
+    , index(narrow(_prefix.index))
+    , quantity(narrow(_prefix.quantity))
+    , prefix(static_cast<std::uint8_t>(_prefix.flags))
+    , allocated(false)
+    , folded(_folded)
+{
+    // Nothing to do.
+}
+
+Argument::Argument(const Argument &other)
+    : source(other.source)
+    , configuration(other.configuration)
+    , position(other.position)
+    , original_begin(other.original_begin)
+    , original_length(other.original_length)
+    , content_begin(other.content_begin)
+    , content_length(other.content_length)
+    , index(other.index)
+    , quantity(other.quantity)
+    , prefix(other.prefix)
+    , allocated(false)
+{
+    if (source == nullptr) {
+        this->store(std::string_view(other.data(), other.stored_length()));
+    } else {
+        // The copy must not depend on the buffer of the interpreter, which is
+        // overwritten by its next parse, so it takes its own copy of the text.
+        folded = other.folded;
+        this->detach();
+    }
+    // The configuration belongs to the interpreter as well, so evaluate the prefixes while it is still there.
+    this->resolve();
+    configuration = nullptr;
+}
+
+Argument::Argument(const Argument &other, Shared)
+    : source(other.source)
+    , configuration(other.configuration)
+    , position(other.position)
+    , original_begin(other.original_begin)
+    , original_length(other.original_length)
+    , content_begin(other.content_begin)
+    , content_length(other.content_length)
+    , index(other.index)
+    , quantity(other.quantity)
+    , prefix(other.prefix)
+    , allocated(false)
+{
+    if (source == nullptr) {
+        this->store(std::string_view(other.data(), other.stored_length()));
+    } else {
+        folded = other.folded;
+    }
+}
+
+Argument::Argument(Argument &&other) noexcept
+    : source(other.source)
+    , configuration(other.configuration)
+    , position(other.position)
+    , original_begin(other.original_begin)
+    , original_length(other.original_length)
+    , content_begin(other.content_begin)
+    , content_length(other.content_length)
+    , index(other.index)
+    , quantity(other.quantity)
+    , prefix(other.prefix)
+    , allocated(other.allocated)
+{
+    // Take the buffer, or copy the inline text.
+    if (allocated) {
+        heap = other.heap;
+    } else if (source == nullptr) {
+        std::memcpy(local, other.local, inline_capacity);
+    } else {
+        folded = other.folded;
+    }
+    other.allocated = false;
+}
+
+auto Argument::operator=(const Argument &other) -> Argument &
+{
+    if (this != &other) {
+        *this = Argument(other);
+    }
+    return *this;
+}
+
+auto Argument::operator=(Argument &&other) noexcept -> Argument &
+{
+    if (this != &other) {
+        if (allocated) {
+            delete[] heap;
+        }
+        source          = other.source;
+        configuration   = other.configuration;
+        position        = other.position;
+        original_begin  = other.original_begin;
+        original_length = other.original_length;
+        content_begin   = other.content_begin;
+        content_length  = other.content_length;
+        index           = other.index;
+        quantity        = other.quantity;
+        prefix          = other.prefix;
+        allocated       = other.allocated;
+        // Take the buffer, or copy the inline text.
+        if (allocated) {
+            heap = other.heap;
+        } else if (source == nullptr) {
+            std::memcpy(local, other.local, inline_capacity);
+        } else {
+            folded = other.folded;
+        }
+        other.allocated = false;
+    }
+    return *this;
+}
+
+Argument::~Argument()
+{
+    if (allocated) {
+        delete[] heap;
+    }
 }
 
 void Argument::parse(const std::string &_original)
 {
-    original = _original;
-    content  = _original;
-    index    = 1;
-    quantity = 1;
-    prefix   = 0;
+    this->store(_original);
+    source          = nullptr;
+    configuration   = nullptr;
+    original_begin  = 0;
+    original_length = narrow(_original.length());
+    content_begin   = 0;
+    content_length  = narrow(_original.length());
+    index           = 1;
+    quantity        = 1;
+    prefix          = 0;
     // Evaluate all the prefix.
-    this->evaluate_all_prefix();
+    this->evaluate_all_prefix(
+        this->get_original_view().find_first_of(this->get_config().get_symbols_index()),
+        this->get_original_view().find_first_of(this->get_config().get_symbols_multiplier()));
 }
 
-auto Argument::length() const -> size_t { return content.length(); }
+auto Argument::length() const -> size_t
+{
+    this->resolve();
+    return content_length;
+}
 
-auto Argument::empty() const -> bool { return content.empty(); }
+auto Argument::empty() const -> bool
+{
+    this->resolve();
+    return content_length == 0;
+}
+
+auto Argument::get_original() const -> std::string { return std::string(this->get_original_view()); }
+
+auto Argument::get_original_view() const -> std::string_view
+{
+    return std::string_view(this->data() + original_begin, original_length);
+}
+
+auto Argument::get_content() const -> std::string { return std::string(this->get_content_view()); }
 
-auto Argument::get_original() const -> std::string { return original; }
+auto Argument::get_content_view() const -> std::string_view
+{
+    this->resolve();
+    return std::string_view(this->data() + content_begin, content_length);
+}
 
-auto Argument::get_content() const -> std::string { return content; }
+void Argument::set_content(const std::string &_content)
+{
+    this->resolve();
+    // Keep the original, and place the new content right after it.
+    this->store(this->get_original_view(), _content);
+    source         = nullptr;
+    original_begin = 0;
+    content_begin  = original_length;
+    content_length = narrow(_content.length());
+}
 
-void Argument::set_content(const std::string &_content) { content = _content; }
+auto Argument::get_index() const -> std::size_t
+{
+    this->resolve();
+    return index;
+}
 
-auto Argument::get_index() const -> std::size_t { return index; }
+void Argument::set_index(std::size_t _index)
+{
+    this->resolve();
+    index = narrow(_index);
+}
 
-void Argument::set_index(std::size_t _index) { index = _index; }
+auto Argument::map_to_option(const OptionSet &options) const -> unsigned
+{
+    return options.find(this->get_content_view());
+}
 
-auto Argument::get_quantity() const -> std::size_t { return quantity; }
+auto Argument::get_quantity() const -> std::size_t
+{
+    this->resolve();
+    return quantity;
+}
 
-void Argument::set_quantity(std::size_t _quantity) { quantity = _quantity; }
+void Argument::set_quantity(std::size_t _quantity)
+{
+    this->resolve();
+    quantity = narrow(_quantity);
+}
 
 auto Argument::has_only_one_prefix() const -> bool
 {
@@ -62,116 +338,208 @@ auto Argument::has_only_one_prefix() const -> bool
             static_cast<int>(this->has_index())) <= 1;
 }
 
-auto Argument::has_prefix_all() const -> bool { return (prefix & FLAG_ALL) == FLAG_ALL; }
+auto Argument::has_prefix_all() const -> bool
+{
+    this->resolve();
+    return (prefix & Prefix::FLAG_ALL) == Prefix::FLAG_ALL;
+}
+
+auto Argument::has_quantity() const -> bool
+{
+    this->resolve();
+    return (prefix & Prefix::FLAG_QUANTITY) == Prefix::FLAG_QUANTITY;
+}
 
-auto Argument::has_quantity() const -> bool { return (prefix & FLAG_QUANTITY) == FLAG_QUANTITY; }
+auto Argument::has_index() const -> bool
+{
+    this->resolve();
+    return (prefix & Prefix::FLAG_INDEX) == Prefix::FLAG_INDEX;
+}
 
-auto Argument::has_index() const -> bool { return (prefix & FLAG_INDEX) == FLAG_INDEX; }
+auto Argument::means_all() const -> bool
+{
+    const char *lowercase = this->folded_data();
+    if (lowercase != nullptr) {
+        return this->get_config().means_all(std::string_view(lowercase + original_begin, original_length), true);
+    }
+    return this->get_config().means_all(this->get_original_view());
+}
 
-auto Argument::means_all() const -> bool { return interpreter::config::means_all(original); }
+auto Argument::begins_with(std::string_view _prefix, bool sensitive) const -> bool
+{
+    std::string_view content = this->get_content_view();
+    if (_prefix.length() > content.length()) {
+        return false;
+    }
+    if (sensitive) {
+        return content.compare(0, _prefix.length(), _prefix) == 0;
+    }
+    const char *lowercase = this->folded_data();
+    if (lowercase != nullptr) {
+        return same(std::string_view(lowercase + content_begin, _prefix.length()), _prefix, true);
+    }
+    return same(content.substr(0, _prefix.length()), _prefix, false);
+}
 
 auto Argument::is_abbreviation_of(const std::string &full_string, bool sensitive, std::size_t min_length) const -> bool
 {
-    return ustr::is_abbreviation_of(content, full_string, sensitive, min_length);
+    std::string_view content = this->get_content_view();
+    if (content.empty() || (content.length() < min_length) || (content.length() > full_string.length())) {
+        return false;
+    }
+    if (sensitive) {
+        return full_string.compare(0, content.length(), content) == 0;
+    }
+    const char *lowercase = this->folded_data();
+    if (lowercase != nullptr) {
+        return same(std::string_view(lowercase + content_begin, content_length), full_string, true);
+    }
+    return same(content, full_string, false);
 }
 
-auto Argument::is_number() const -> bool { return ustr::is_number(original); }
+auto Argument::is_number() const -> bool
+{
+    std::string_view original = this->get_original_view();
+    std::size_t start         = (!original.empty() && ((original[0] == '-') || (original[0] == '+'))) ? 1 : 0;
+    if (start == original.length()) {
+        return false;
+    }
+    for (std::size_t it = start; it < original.length(); ++it) {
+        if ((original[it] < '0') || (original[it] > '9')) {
+            return false;
+        }
+    }
+    return true;
+}
 
-auto Argument::operator==(const std::string &rhs) const -> bool { return content == rhs; }
+auto Argument::operator==(const std::string &rhs) const -> bool { return this->get_content_view() == rhs; }
 
-auto Argument::operator[](std::size_t pos) const -> char { return content[pos]; }
+auto Argument::operator[](std::size_t pos) const -> char
+{
+    this->resolve();
+    return this->data()[content_begin + pos];
+}
 
-auto Argument::operator[](std::size_t pos) -> char & { return content[pos]; }
+auto Argument::operator[](std::size_t pos) -> char &
+{
+    // The text is about to be modified, so it must be ours.
+    this->detach();
+    return (allocated ? heap : local)[content_begin + pos];
+}
 
 auto operator<<(std::ostream &lhs, const Argument &rhs) -> std::ostream &
 {
-    lhs << rhs.content;
+    lhs << rhs.get_content_view();
     return lhs;
 }
 
-void Argument::evaluate_all_prefix()
+auto Argument::get_config() const -> const Config &
 {
-    // Get the position of index and quantity.
-    std::string::size_type index_pos    = content.find_first_of(interpreter::config::list_of_symbols_index);
-    std::string::size_type quantity_pos = content.find_first_of(interpreter::config::list_of_symbols_multiplier);
-    // Evaluate which one comes first.
-    if (index_pos < quantity_pos) {
-        this->evaluate_index();
-        this->evaluate_quantity();
-    } else {
-        this->evaluate_quantity();
-        this->evaluate_index();
-    }
+    return (configuration != nullptr) ? *configuration : *config::snapshot();
 }
 
-void Argument::evaluate_index()
+auto Argument::share(const Argument &other) -> Argument { return Argument(other, Shared()); }
+
+auto Argument::data() const -> const char *
 {
-    // If the entire string is a number, skip it.
-    if (ustr::is_number(content)) {
-        return;
+    if (source != nullptr) {
+        return source;
     }
-    // Otherwise try to find a number if there is one.
-    std::string::size_type pos = content.find_first_of(interpreter::config::list_of_symbols_index);
-    if (pos == std::string::npos) {
-        return;
+    return allocated ? heap : local;
+}
+
+auto Argument::folded_data() const -> const char *
+{
+    // The lowercase copy is only there while the text is inside the external buffer.
+    return (source != nullptr) ? folded : nullptr;
+}
+
+auto Argument::begins_with_folded(std::string_view _prefix) const -> bool
+{
+    std::string_view content = this->get_content_view();
+    if (_prefix.length() > content.length()) {
+        return false;
     }
-    // Extract the digits.
-    std::string digits = content.substr(0, pos);
-    // Check the digits.
-    if (ustr::is_number(digits)) {
-        // Get the number and set it.
-        auto number = ustr::to_number<std::size_t>(digits);
-        if (number < INT_MAX) {
-            // Set the number.
-            index = number;
-            // Set the prefix flag.
-            prefix |= FLAG_INDEX;
-        }
-        // Remove the digits.
-        content = content.substr(pos + 1, content.size());
-    } else {
-        if (interpreter::config::means_all(digits)) {
-            // Remove the quantity.
-            content = content.substr(pos + 1, content.size());
-            // Set the prefix flag.
-            prefix |= FLAG_ALL;
-        }
+    const char *lowercase = this->folded_data();
+    if (lowercase != nullptr) {
+        return std::memcmp(lowercase + content_begin, _prefix.data(), _prefix.length()) == 0;
     }
+    return same(content.substr(0, _prefix.length()), _prefix, false);
 }
 
-void Argument::evaluate_quantity()
+auto Argument::must_ignore(const Config &config) const -> bool
 {
-    // If the entire string is a number, skip it.
-    if (ustr::is_number(content)) {
-        return;
+    const char *lowercase = this->folded_data();
+    if (lowercase != nullptr) {
+        this->resolve();
+        return config.must_ignore(std::string_view(lowercase + content_begin, content_length), true);
     }
-    // Otherwise try to find a number if there is one.
-    std::string::size_type pos = content.find_first_of(interpreter::config::list_of_symbols_multiplier);
-    if (pos == std::string::npos) {
-        return;
+    return config.must_ignore(this->get_content_view());
+}
+
+void Argument::detach()
+{
+    this->resolve();
+    if (source != nullptr) {
+        this->store(this->get_original_view());
+        content_begin -= original_begin;
+        original_begin = 0;
+        source         = nullptr;
     }
-    // Extract the digits.
-    std::string digits = content.substr(0, pos);
-    // Check the digits.
-    if (ustr::is_number(digits)) {
-        // Get the number and set it.
-        auto number = ustr::to_number<std::size_t>(digits);
-        if (number < INT_MAX) {
-            // Set the number.
-            quantity = number;
-            // Set the prefix flag.
-            prefix |= FLAG_QUANTITY;
+}
+
+void Argument::store(std::string_view first, std::string_view second)
+{
+    std::size_t total = first.length() + second.length();
+    if (total <= inline_capacity) {
+        // Go through a temporary buffer, since the strings might be inside `local`, or `heap`.
+        char buffer[inline_capacity];
+        std::copy(first.begin(), first.end(), buffer);
+        std::copy(second.begin(), second.end(), buffer + first.length());
+        if (allocated) {
+            delete[] heap;
+            allocated = false;
         }
-        // Remove the digits.
-        content = content.substr(pos + 1, content.size());
+        std::memcpy(local, buffer, total);
     } else {
-        if (interpreter::config::means_all(digits)) {
-            // Remove the quantity.
-            content = content.substr(pos + 1, content.size());
-            // Set the prefix flag.
-            prefix |= FLAG_ALL;
+        // Allocate before releasing, since the strings might be inside `heap`.
+        char *buffer = new char[total];
+        std::copy(first.begin(), first.end(), buffer);
+        std::copy(second.begin(), second.end(), buffer + first.length());
+        if (allocated) {
+            delete[] heap;
         }
+        heap      = buffer;
+        allocated = true;
     }
 }
 
+auto Argument::stored_length() const -> std::size_t
+{
+    if (source != nullptr) {
+        return 0;
+    }
+    return std::max(original_begin + original_length, content_begin + content_length);
+}
+
+void Argument::resolve() const
+{
+    if ((prefix & unresolved) != 0) {
+        // While unresolved, the index and the quantity hold the positions of the symbols.
+        this->evaluate_all_prefix(
+            (index == UINT32_MAX) ? std::string_view::npos : index,
+            (quantity == UINT32_MAX) ? std::string_view::npos : quantity);
+    }
+}
+
+void Argument::evaluate_all_prefix(std::size_t index_pos, std::size_t quantity_pos) const
+{
+    Prefix result   = Prefix::evaluate(this->get_original_view(), index_pos, quantity_pos, this->get_config());
+    content_begin   = narrow(original_begin + result.content_begin);
+    content_length  = narrow(result.content_length);
+    index           = narrow(result.index);
+    quantity        = narrow(result.quantity);
+    prefix          = static_cast<std::uint8_t>(result.flags);
+}
+
 } // namespace interpreter
@@ -0,0 +1,147 @@
+/// @file batch.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the batch, which parses many input lines at once.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/batch.hpp"
+#include "interpreter/tokenizer.hpp"
+
+namespace interpreter
+{
+
+ParseBatch::ParseBatch(std::shared_ptr<const Config> config)
+    : configuration(std::move(config))
+    , pinned(configuration != nullptr)
+{
+    // Nothing to do.
+}
+
+void ParseBatch::parse(const std::string_view *lines, std::size_t count, bool ignore)
+{
+    this->clear();
+    // Follow the current snapshot, unless the user chose the configuration.
+    if (!pinned) {
+        const std::shared_ptr<const Config> &current = config::snapshot();
+        if (configuration != current) {
+            configuration = current;
+        }
+    }
+    const Config &config = *configuration;
+    // Copy the lines one after the other, separated by new lines.
+    std::size_t total = 0;
+    for (std::size_t it = 0; it < count; ++it) {
+        total += lines[it].length() + 1;
+    }
+    text.reserve(total);
+    line_begin.reserve(count);
+    line_length.reserve(count);
+    for (std::size_t it = 0; it < count; ++it) {
+        line_begin.push_back(static_cast<std::uint32_t>(text.length()));
+        line_length.push_back(static_cast<std::uint32_t>(lines[it].length()));
+        text.append(lines[it]);
+        text.push_back('\n');
+    }
+    line_first.assign(count + 1, 0);
+    // Tokenize all the lines in a single pass, the new lines keep the words apart.
+    std::size_t line = 0;
+    Tokenizer tokenizer(config.get_symbols_index(), config.get_symbols_multiplier());
+    tokenizer.tokenize(text, [this, ignore, &config, &line](const Token &token) {
+        std::string_view word(text.data() + token.begin, token.length);
+        if (ignore && config.must_ignore(word)) {
+            return;
+        }
+        // The words come in order, so the lines are only walked forward.
+        while (token.begin >= (line_begin[line] + line_length[line])) {
+            line_first[++line] = static_cast<std::uint32_t>(word_begin.size());
+        }
+        Prefix prefix = Prefix::evaluate(word, token.index_pos, token.quantity_pos, config);
+        word_begin.push_back(static_cast<std::uint32_t>(token.begin));
+        word_length.push_back(static_cast<std::uint32_t>(token.length));
+        content_begin.push_back(static_cast<std::uint32_t>(token.begin + prefix.content_begin));
+        content_length.push_back(static_cast<std::uint32_t>(prefix.content_length));
+        index.push_back(static_cast<std::uint32_t>(prefix.index));
+        quantity.push_back(static_cast<std::uint32_t>(prefix.quantity));
+        flags.push_back(static_cast<std::uint8_t>(prefix.flags));
+    });
+    while (line < count) {
+        line_first[++line] = static_cast<std::uint32_t>(word_begin.size());
+    }
+}
+
+void ParseBatch::parse(const std::vector<std::string> &lines, bool ignore)
+{
+    std::vector<std::string_view> views(lines.begin(), lines.end());
+    this->parse(views.data(), views.size(), ignore);
+}
+
+void ParseBatch::clear()
+{
+    text.clear();
+    line_begin.clear();
+    line_length.clear();
+    line_first.assign(1, 0);
+    word_begin.clear();
+    word_length.clear();
+    content_begin.clear();
+    content_length.clear();
+    index.clear();
+    quantity.clear();
+    flags.clear();
+}
+
+auto ParseBatch::get_config() const -> const std::shared_ptr<const Config> & { return configuration; }
+
+auto ParseBatch::size() const -> std::size_t { return line_begin.size(); }
+
+auto ParseBatch::get_word_count() const -> std::size_t { return word_begin.size(); }
+
+auto ParseBatch::get_line(std::size_t line) const -> std::string_view
+{
+    return std::string_view(text.data() + line_begin[line], line_length[line]);
+}
+
+auto ParseBatch::get_first_word(std::size_t line) const -> std::size_t { return line_first[line]; }
+
+auto ParseBatch::get_word_count(std::size_t line) const -> std::size_t
+{
+    return line_first[line + 1] - line_first[line];
+}
+
+auto ParseBatch::get_original_view(std::size_t word) const -> std::string_view
+{
+    return std::string_view(text.data() + word_begin[word], word_length[word]);
+}
+
+auto ParseBatch::get_content_view(std::size_t word) const -> std::string_view
+{
+    return std::string_view(text.data() + content_begin[word], content_length[word]);
+}
+
+auto ParseBatch::get_prefix(std::size_t word) const -> Prefix
+{
+    return Prefix{
+        content_begin[word] - word_begin[word], content_length[word], index[word], quantity[word], flags[word]};
+}
+
+auto ParseBatch::get_index(std::size_t word) const -> std::size_t { return index[word]; }
+
+auto ParseBatch::get_quantity(std::size_t word) const -> std::size_t { return quantity[word]; }
+
+auto ParseBatch::has_prefix_all(std::size_t word) const -> bool
+{
+    return (flags[word] & Prefix::FLAG_ALL) == Prefix::FLAG_ALL;
+}
+
+auto ParseBatch::has_quantity(std::size_t word) const -> bool
+{
+    return (flags[word] & Prefix::FLAG_QUANTITY) == Prefix::FLAG_QUANTITY;
+}
+
+auto ParseBatch::has_index(std::size_t word) const -> bool
+{
+    return (flags[word] & Prefix::FLAG_INDEX) == Prefix::FLAG_INDEX;
+}
+
+} // namespace interpreter
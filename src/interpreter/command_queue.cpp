@@ -0,0 +1,104 @@
+/// @file command_queue.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the bounded lock-free queue of parsed commands.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/command_queue.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace interpreter
+{
+
+CommandQueue::CommandQueue(std::size_t capacity, std::size_t _sessions, std::uint32_t _session_limit)
+    : slots()
+    , mask(0)
+    , tail(0)
+    , head(0)
+    , pending(std::make_unique<std::atomic<std::uint32_t>[]>(_sessions))
+    , sessions(_sessions)
+    , session_limit((_session_limit > 0) ? _session_limit : 1)
+{
+    std::size_t size = 2;
+    while (size < capacity) {
+        size <<= 1U;
+    }
+    slots = std::make_unique<Slot[]>(size);
+    mask  = size - 1;
+    for (std::size_t it = 0; it < size; ++it) {
+        slots[it].sequence.store(it, std::memory_order_relaxed);
+    }
+    for (std::size_t it = 0; it < sessions; ++it) {
+        pending[it].store(0, std::memory_order_relaxed);
+    }
+}
+
+auto CommandQueue::push(std::uint32_t session, Interpreter &args) -> Result
+{
+    if (session >= sessions) {
+        return Result::bad_session;
+    }
+    // Reserve a place for the session first, so that it never exceeds its limit.
+    if (pending[session].fetch_add(1, std::memory_order_relaxed) >= session_limit) {
+        pending[session].fetch_sub(1, std::memory_order_relaxed);
+        return Result::session_full;
+    }
+    std::size_t position = tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+        slot                 = &slots[position & mask];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == position) {
+            // The slot is free, try to claim it.
+            if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < position) {
+            // The slot still holds the command of the previous lap.
+            pending[session].fetch_sub(1, std::memory_order_relaxed);
+            return Result::queue_full;
+        } else {
+            // Another producer claimed the slot meanwhile.
+            position = tail.load(std::memory_order_relaxed);
+        }
+    }
+    slot->session = session;
+    std::swap(slot->args, args);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return Result::accepted;
+}
+
+auto CommandQueue::pop(std::uint32_t &session, Interpreter &args) -> bool
+{
+    Slot &slot = slots[head & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != (head + 1)) {
+        return false;
+    }
+    session = slot.session;
+    assert(session < sessions);
+    std::swap(slot.args, args);
+    // Hand the slot to the producers of the next lap.
+    slot.sequence.store(head + mask + 1, std::memory_order_release);
+    ++head;
+    pending[session].fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+auto CommandQueue::is_throttled(std::uint32_t session) const -> bool
+{
+    assert(session < sessions);
+    return pending[session].load(std::memory_order_acquire) >= session_limit;
+}
+
+auto CommandQueue::get_pending(std::uint32_t session) const -> std::uint32_t
+{
+    assert(session < sessions);
+    return pending[session].load(std::memory_order_acquire);
+}
+
+auto CommandQueue::capacity() const -> std::size_t { return mask + 1; }
+
+} // namespace interpreter
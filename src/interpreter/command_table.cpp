@@ -0,0 +1,64 @@
+/// @file command_table.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the table which dispatches the input to the commands.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/command_table.hpp"
+
+namespace interpreter
+{
+
+void CommandTable::add(
+    const std::string &name,
+    Handler handler,
+    std::size_t min_length,
+    int priority,
+    std::size_t arguments)
+{
+    index.insert(name, static_cast<std::uint32_t>(commands.size()), min_length, priority);
+    commands.push_back(Command{name, min_length, priority, std::move(handler), arguments});
+}
+
+void CommandTable::build() const { index.build(); }
+
+auto CommandTable::find(std::string_view word) const -> const Command *
+{
+    std::uint32_t position = index.find(word);
+    if (position == PrefixTrie::none) {
+        return nullptr;
+    }
+    return &commands[position];
+}
+
+auto CommandTable::dispatch(Interpreter &args) const -> bool
+{
+    const Command *command = this->find(args[0].get_content_view());
+    if ((command == nullptr) || !command->handler) {
+        return false;
+    }
+    args.erase(0);
+    return command->handler(args);
+}
+
+auto CommandTable::dispatch(Interpreter &args, std::string_view input, bool ignore) const -> bool
+{
+    // Parse the name alone, then as many arguments as the command needs.
+    args.parse(input, ignore, 1);
+    const Command *command = this->find(args[0].get_content_view());
+    if ((command == nullptr) || !command->handler) {
+        return false;
+    }
+    // Continue from where the name ends, the commands without arguments keep the rest as it was typed.
+    if ((command->arguments != 0) && !args.get_rest().empty()) {
+        std::size_t limit = (command->arguments == std::string::npos) ? command->arguments : (command->arguments + 1);
+        args.parse_rest(ignore, limit);
+    }
+    args.erase(0);
+    return command->handler(args);
+}
+
+auto CommandTable::size() const -> std::size_t { return commands.size(); }
+
+} // namespace interpreter
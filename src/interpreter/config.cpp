@@ -7,11 +7,110 @@
 
 #include "interpreter/config.hpp"
 
-#include <ustr/check.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+
+/// The identifier given to the next snapshot.
+std::atomic<std::uint64_t> next_version(1);
+
+/// @brief The snapshot shared by all the threads.
+struct Global {
+    /// Serializes the threads installing, or loading, the snapshot.
+    std::mutex mutex;
+    /// The current snapshot, only accessed while holding the mutex.
+    std::shared_ptr<const interpreter::Config> current;
+    /// The version of the current snapshot, 0 if there is none yet.
+    std::atomic<std::uint64_t> version{0};
+    /// If the current snapshot was built from the lists, so that it follows their changes.
+    std::atomic<bool> from_lists{false};
+    /// Builds the first snapshot from the lists, unless one was installed before.
+    std::once_flag initialized;
+};
+
+/// @brief Provides the snapshot shared by all the threads.
+/// @return the shared snapshot.
+auto get_global() -> Global &
+{
+    static Global global;
+    return global;
+}
+
+/// @brief Builds a snapshot from the lists.
+/// @return the snapshot.
+auto build_from_lists() -> std::shared_ptr<const interpreter::Config>
+{
+    using namespace interpreter;
+    return std::make_shared<const Config>(
+        config::list_of_all, config::list_of_ingnore, config::list_of_symbols_multiplier,
+        config::list_of_symbols_index);
+}
+
+/// @brief Checks if the lists are different from those the snapshot was built from.
+/// @param config the snapshot.
+/// @return true if they changed.
+auto lists_differ(const interpreter::Config &config) -> bool
+{
+    using namespace interpreter;
+    return (config.get_list_of_all() != config::list_of_all) ||
+           (config.get_list_of_ignore() != config::list_of_ingnore) ||
+           (config.get_symbols_multiplier() != config::list_of_symbols_multiplier) ||
+           (config.get_symbols_index() != config::list_of_symbols_index);
+}
+
+/// @brief Replaces the current snapshot.
+/// @param config the new snapshot.
+/// @param from_lists if it was built from the lists.
+void publish(std::shared_ptr<const interpreter::Config> config, bool from_lists)
+{
+    Global &global = get_global();
+    std::lock_guard<std::mutex> lock(global.mutex);
+    std::uint64_t version = config->get_version();
+    global.current        = std::move(config);
+    global.from_lists.store(from_lists, std::memory_order_relaxed);
+    global.version.store(version, std::memory_order_release);
+}
+
+} // namespace
 
 namespace interpreter
 {
 
+Config::Config(
+    std::vector<std::string> _list_of_all,
+    std::vector<std::string> _list_of_ignore,
+    std::string _symbols_multiplier,
+    std::string _symbols_index)
+    : list_of_all(std::move(_list_of_all))
+    , list_of_ignore(std::move(_list_of_ignore))
+    , symbols_multiplier(std::move(_symbols_multiplier))
+    , symbols_index(std::move(_symbols_index))
+    , all_words(list_of_all)
+    , ignored_words(list_of_ignore)
+    , version(next_version.fetch_add(1))
+{
+    // Nothing to do.
+}
+
+auto Config::means_all(std::string_view word, bool folded) const -> bool { return all_words.contains(word, folded); }
+
+auto Config::must_ignore(std::string_view word, bool folded) const -> bool
+{
+    return ignored_words.contains(word, folded);
+}
+
+auto Config::get_list_of_all() const -> const std::vector<std::string> & { return list_of_all; }
+
+auto Config::get_list_of_ignore() const -> const std::vector<std::string> & { return list_of_ignore; }
+
+auto Config::get_symbols_multiplier() const -> const std::string & { return symbols_multiplier; }
+
+auto Config::get_symbols_index() const -> const std::string & { return symbols_index; }
+
+auto Config::get_version() const -> std::uint64_t { return version; }
+
 namespace config
 {
 
@@ -20,16 +119,51 @@ std::vector<std::string> list_of_ingnore = {"in", "from", "with", "and", "the",
 std::string list_of_symbols_multiplier   = "*";
 std::string list_of_symbols_index        = ".";
 
-auto means_all(const std::string &word) -> bool
+auto snapshot() -> const std::shared_ptr<const Config> &
 {
-    return ustr::word_is_among(word, interpreter::config::list_of_all, false, false, false, true);
+    // Every thread keeps its own copy, so that reading it does not lock.
+    thread_local std::shared_ptr<const Config> cached;
+    Global &global        = get_global();
+    std::uint64_t version = global.version.load(std::memory_order_acquire);
+    if (version == 0) {
+        std::call_once(global.initialized, []() {
+            if (get_global().version.load(std::memory_order_acquire) == 0) {
+                config::update();
+            }
+        });
+        version = global.version.load(std::memory_order_acquire);
+    }
+    if (!cached || (cached->get_version() != version)) {
+        // It only happens when a new snapshot is installed, so the lock is not on the way of the parsing.
+        std::lock_guard<std::mutex> lock(global.mutex);
+        cached = global.current;
+    }
+    // Follow the changes to the lists, unless a snapshot was installed on purpose.
+    if (global.from_lists.load(std::memory_order_relaxed) && lists_differ(*cached)) {
+        publish(build_from_lists(), true);
+        std::lock_guard<std::mutex> lock(global.mutex);
+        cached = global.current;
+    }
+    return cached;
 }
 
-auto must_ignore(const std::string &word) -> bool
+auto get_version() -> std::uint64_t { return get_global().version.load(std::memory_order_acquire); }
+
+void install(std::shared_ptr<const Config> config)
 {
-    return ustr::word_is_among(word, interpreter::config::list_of_ingnore, false, false, false, true);
+    if (!config) {
+        config::update();
+    } else {
+        publish(std::move(config), false);
+    }
 }
 
+void update() { publish(build_from_lists(), true); }
+
+auto means_all(std::string_view word) -> bool { return config::snapshot()->means_all(word); }
+
+auto must_ignore(std::string_view word) -> bool { return config::snapshot()->must_ignore(word); }
+
 } // namespace config
 
 } // namespace interpreter
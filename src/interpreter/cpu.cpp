@@ -0,0 +1,59 @@
+/// @file cpu.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the runtime detection of the instruction sets.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/cpu.hpp"
+
+#if defined(MUDINT_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace
+{
+
+/// @brief Asks the processor if it supports AVX2.
+/// @return true if AVX2 can be used.
+auto detect_avx2() -> bool
+{
+#if !defined(MUDINT_X86)
+    return false;
+#elif defined(_MSC_VER)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    // The OS must save the AVX registers (OSXSAVE and XCR0).
+    if (((info[2] & (1 << 27)) == 0) || ((_xgetbv(0) & 6U) != 6U)) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+} // namespace
+
+namespace interpreter
+{
+
+namespace cpu
+{
+
+auto has_avx2() -> bool
+{
+    static const bool supported = detect_avx2();
+    return supported;
+}
+
+} // namespace cpu
+
+} // namespace interpreter
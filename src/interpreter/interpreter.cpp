@@ -7,77 +7,307 @@
 
 #include "interpreter/interpreter.hpp"
 
+#include <algorithm>
+
+namespace
+{
+
+/// @brief The longest string searched by find() which is folded only once.
+constexpr std::size_t find_capacity = 64;
+
+/// @brief Turns an ASCII character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+} // namespace
+
 namespace interpreter
 {
 
+Interpreter::Interpreter(Arena &arena)
+    : original(ArenaAllocator<char>(&arena))
+    , folded(ArenaAllocator<char>(&arena))
+    , arguments(ArenaAllocator<Argument>(&arena))
+{
+    // Nothing to do.
+}
+
+Interpreter::Interpreter(std::shared_ptr<const Config> config) { this->set_config(config); }
+
+Interpreter::Interpreter(Arena &arena, std::shared_ptr<const Config> config)
+    : Interpreter(arena)
+{
+    this->set_config(config);
+}
+
 Interpreter::Interpreter(const char *input, bool ignore) { this->parse(input, ignore); }
 
-auto Interpreter::get_original() const -> std::string { return original; }
+Interpreter::Interpreter(const Interpreter &other)
+    : original(other.original)
+    , folded(other.folded)
+    , arguments(std::allocator_traits<vector_type::allocator_type>::select_on_container_copy_construction(
+          other.arguments.get_allocator()))
+    , configuration(other.configuration)
+    , pinned(other.pinned)
+    , rest_begin(other.rest_begin)
+    , rest_length(other.rest_length)
+    , head(other.head)
+{
+    this->share(other.arguments);
+    this->rebase(other.original.data(), other.folded.data());
+}
+
+auto Interpreter::operator=(const Interpreter &other) -> Interpreter &
+{
+    if (this != &other) {
+        original      = other.original;
+        folded        = other.folded;
+        this->share(other.arguments);
+        configuration = other.configuration;
+        pinned        = other.pinned;
+        rest_begin    = other.rest_begin;
+        rest_length   = other.rest_length;
+        head          = other.head;
+        this->rebase(other.original.data(), other.folded.data());
+    }
+    return *this;
+}
+
+Interpreter::Interpreter(Interpreter &&other) noexcept { *this = std::move(other); }
+
+auto Interpreter::operator=(Interpreter &&other) noexcept -> Interpreter &
+{
+    if (this != &other) {
+        const char *previous        = other.original.data();
+        const char *previous_folded = other.folded.data();
+        original                    = std::move(other.original);
+        folded                      = std::move(other.folded);
+        arguments                   = std::move(other.arguments);
+        configuration               = std::move(other.configuration);
+        pinned                      = other.pinned;
+        rest_begin                  = other.rest_begin;
+        rest_length                 = other.rest_length;
+        head                        = other.head;
+        // Small strings are copied when moved, so the buffers might have changed.
+        this->rebase(previous, previous_folded);
+        other.original.clear();
+        other.folded.clear();
+        other.arguments.clear();
+        other.rest_begin  = 0;
+        other.rest_length = 0;
+        other.head        = 0;
+    }
+    return *this;
+}
+
+auto Interpreter::get_original() const -> std::string { return std::string(original.data(), original.size()); }
+
+auto Interpreter::get_original_view() const -> std::string_view { return original; }
+
+auto Interpreter::get_rest() const -> std::string_view
+{
+    return std::string_view(original.data() + rest_begin, rest_length);
+}
+
+auto Interpreter::get_config() const -> const Config &
+{
+    return configuration ? *configuration : *config::snapshot();
+}
+
+void Interpreter::set_config(const std::shared_ptr<const Config> &config)
+{
+    pinned = (config != nullptr);
+    // Avoid touching the reference count when the configuration does not change.
+    if (configuration != config) {
+        // The arguments refer to the configuration, so evaluate their prefixes while it is still there.
+        for (auto &argument : arguments) {
+            if (argument.configuration != nullptr) {
+                argument.resolve();
+                argument.configuration = config.get();
+            }
+        }
+        configuration = config;
+    }
+}
 
-auto Interpreter::size() const -> size_t { return arguments.size(); }
+auto Interpreter::size() const -> size_t { return arguments.size() - head; }
 
-auto Interpreter::empty() const -> bool { return arguments.empty(); }
+auto Interpreter::empty() const -> bool { return arguments.size() == head; }
 
-auto Interpreter::begin() -> Interpreter::iterator { return arguments.begin(); }
+auto Interpreter::begin() -> Interpreter::iterator { return arguments.begin() + static_cast<std::ptrdiff_t>(head); }
 
-auto Interpreter::begin() const -> Interpreter::const_iterator { return arguments.begin(); }
+auto Interpreter::begin() const -> Interpreter::const_iterator
+{
+    return arguments.begin() + static_cast<std::ptrdiff_t>(head);
+}
 
 auto Interpreter::end() -> Interpreter::iterator { return arguments.end(); }
 
 auto Interpreter::end() const -> Interpreter::const_iterator { return arguments.end(); }
 
-auto Interpreter::get(const std::size_t &position) -> Argument & { return arguments.at(position); }
+auto Interpreter::get(const std::size_t &position) -> Argument & { return arguments.at(head + position); }
 
 void Interpreter::parse(const char *input, bool ignore)
+{
+    if (input == nullptr) {
+        this->parse(std::string_view(), ignore);
+    } else {
+        this->parse(std::string_view(input), ignore);
+    }
+}
+
+void Interpreter::parse(std::string_view input, bool ignore, std::size_t limit)
+{
+    this->refresh_config();
+    this->split(input, ignore, limit);
+}
+
+void Interpreter::split(std::string_view input, bool ignore, std::size_t limit)
 {
     original.clear();
     arguments.clear();
-    if (input != nullptr) {
-        // Save the original string.
-        original = input;
-        // Clean the current list of arguments.
-        arguments.clear();
-        // Parse again the input.
-        std::vector<std::string> words = ustr::split(input, " ");
-        // Prepare the iterator.
-        std::vector<std::string>::const_iterator it;
-        // Iterate the words and add them to the list of arguments.
-        for (it = words.begin(); it != words.end(); ++it) {
-            if (!ignore || !interpreter::config::must_ignore(*it)) {
-                arguments.emplace_back(*it);
-            }
+    head = 0;
+    // Save the original string, reusing the buffer we already have.
+    original.assign(input.data(), input.length());
+    this->fold();
+    this->split_from(0, ignore, limit);
+}
+
+void Interpreter::parse_rest(bool ignore, std::size_t limit)
+{
+    if (rest_length > 0) {
+        this->split_from(rest_begin, ignore, limit);
+    }
+}
+
+void Interpreter::split_from(std::size_t begin, bool ignore, std::size_t limit)
+{
+    const Config &config = *configuration;
+    rest_begin           = original.length();
+    rest_length          = 0;
+    // Split the input into words, locating their prefix symbols at the same time.
+    Tokenizer tokenizer(config.get_symbols_index(), config.get_symbols_multiplier());
+    std::string_view text(original.data() + begin, original.length() - begin);
+    tokenizer.tokenize(text, [this, begin, ignore, limit, &config](Token token) {
+        token.begin += begin;
+        if (arguments.size() == limit) {
+            // Keep the rest of the line as it was typed.
+            rest_begin = token.begin;
+            return false;
         }
+        std::string_view word(folded.data() + token.begin, token.length);
+        if (!ignore || !config.must_ignore(word, true)) {
+            arguments.emplace_back(original.data(), token, config, folded.data());
+        }
+        return true;
+    });
+    if (rest_begin < original.length()) {
+        rest_length = original.find_last_not_of(" \t\n\v\f\r") + 1 - rest_begin;
+    }
+}
+
+void Interpreter::parse(const ParseBatch &batch, std::size_t line)
+{
+    original.clear();
+    arguments.clear();
+    head          = 0;
+    configuration = batch.get_config();
+    rest_begin    = 0;
+    rest_length   = 0;
+    // Copy the line, the words keep their position relative to it.
+    std::string_view text = batch.get_line(line);
+    original.assign(text.data(), text.length());
+    this->fold();
+    std::size_t first = batch.get_first_word(line);
+    std::size_t last  = first + batch.get_word_count(line);
+    arguments.reserve(last - first);
+    for (std::size_t word = first; word < last; ++word) {
+        std::string_view view = batch.get_original_view(word);
+        arguments.emplace_back(
+            original.data(), static_cast<std::size_t>(view.data() - text.data()), view.length(), batch.get_prefix(word),
+            *configuration, folded.data());
     }
 }
 
+void Interpreter::clear()
+{
+    // Swapping with empty containers is the only way to give the memory back.
+    string_type(original.get_allocator()).swap(original);
+    string_type(folded.get_allocator()).swap(folded);
+    vector_type(arguments.get_allocator()).swap(arguments);
+    head = 0;
+    rest_begin  = 0;
+    rest_length = 0;
+}
+
 auto Interpreter::find(std::string const &s, bool exact) const -> const Argument *
 {
-    for (const auto &argument : arguments) {
-        if (exact) {
-            if (argument.get_content() == s) {
-                return &argument;
+    if (exact) {
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            if (it->get_content_view() == s) {
+                return &(*it);
             }
-        } else {
-            if (ustr::begin_with(argument.get_content(), s, false, 0)) {
-                return &argument;
+        }
+        return nullptr;
+    }
+    if (s.length() > find_capacity) {
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            if (it->begins_with(s)) {
+                return &(*it);
             }
         }
+        return nullptr;
+    }
+    // Fold the string once, then compare it with the lowercase copy of each argument.
+    char buffer[find_capacity];
+    std::transform(s.begin(), s.end(), buffer, ::fold);
+    std::string_view lowercase(buffer, s.length());
+    for (auto it = this->begin(); it != this->end(); ++it) {
+        if (it->begins_with_folded(lowercase)) {
+            return &(*it);
+        }
     }
     return nullptr;
 }
 
+auto Interpreter::substr_view(std::size_t _start, std::size_t _end) const -> std::string_view
+{
+    if (_end > this->size()) {
+        _end = this->size();
+    }
+    if (_start >= _end) {
+        return std::string_view();
+    }
+    std::string_view input(original.data(), original.length());
+    std::size_t next = arguments[head + _start].position;
+    for (std::size_t it = head + _start; it < head + _end; ++it) {
+        const Argument &argument = arguments[it];
+        std::string_view word    = argument.get_original_view();
+        // Only spaces can separate the word from the previous one, and it must be the word typed there.
+        if ((argument.position < next) || (argument.position > input.length()) ||
+            (input.substr(argument.position, word.length()) != word) ||
+            (input.find_first_not_of(" \t\n\v\f\r", next) < argument.position)) {
+            return std::string_view();
+        }
+        next = argument.position + word.length();
+    }
+    std::size_t first = arguments[head + _start].position;
+    return input.substr(first, next - first);
+}
+
 auto Interpreter::substr(std::size_t _start, std::size_t _end) const -> std::string
 {
     if (_start >= this->size()) {
-        return original;
+        return this->get_original();
     }
-    if (_end == std::string::npos) {
-        _end = arguments.size();
+    if (_end > this->size()) {
+        _end = this->size();
     }
     std::string result;
     for (std::size_t it = _start; it < _end; ++it) {
-        result.append(arguments[it].get_original());
-        if (it != (arguments.size() - 1)) {
+        result.append(arguments[head + it].get_original_view());
+        if (it != (this->size() - 1)) {
             result.push_back(' ');
         }
     }
@@ -86,34 +316,45 @@ auto Interpreter::substr(std::size_t _start, std::size_t _end) const -> std::str
 
 void Interpreter::erase(const std::size_t &position)
 {
-    if (position < arguments.size()) {
-        auto it = arguments.begin();
-        std::advance(it, position);
-        arguments.erase(it);
+    if (position == 0) {
+        this->pop_front();
+    } else if (position < this->size()) {
+        arguments.erase(this->begin() + static_cast<std::ptrdiff_t>(position));
     } else {
         std::cerr << "Position out of bound!\n";
     }
 }
 
-void Interpreter::remove_ignored_words()
+void Interpreter::pop_front()
 {
-    auto it = arguments.begin();
-    while (it != arguments.end()) {
-        if (interpreter::config::must_ignore(it->get_content())) {
-            it = arguments.erase(it);
-        } else {
-            ++it;
-        }
+    if (!this->empty()) {
+        ++head;
+    } else {
+        std::cerr << "Position out of bound!\n";
     }
 }
 
+void Interpreter::consume(std::size_t count)
+{
+    head += std::min(count, this->size());
+}
+
+void Interpreter::remove_ignored_words()
+{
+    const Config &config = this->get_config();
+    // Move the words to keep forward, then drop the tail, in a single pass.
+    auto last = std::remove_if(
+        this->begin(), this->end(), [&config](const Argument &argument) { return argument.must_ignore(config); });
+    arguments.erase(last, arguments.end());
+}
+
 void Interpreter::dump() const
 {
-    for (std::size_t it = 0; it < arguments.size(); ++it) {
-        const interpreter::Argument &argument = arguments[it];
+    for (std::size_t it = 0; it < this->size(); ++it) {
+        const interpreter::Argument &argument = arguments[head + it];
         std::cout << std::setw(2) << std::right << it << " | ";
-        std::cout << std::setw(12) << std::left << argument.get_original();
-        std::cout << std::setw(12) << std::left << argument.get_content() << " | ";
+        std::cout << std::setw(12) << std::left << argument.get_original_view();
+        std::cout << std::setw(12) << std::left << argument.get_content_view() << " | ";
         if (argument.has_index()) {
             std::cout << " Index: " << std::setw(2) << argument.get_index() << " ";
         }
@@ -127,22 +368,78 @@ void Interpreter::dump() const
     }
 }
 
+void Interpreter::refresh_config()
+{
+    if (!pinned) {
+        const std::shared_ptr<const Config> &current = config::snapshot();
+        if (configuration != current) {
+            configuration = current;
+        }
+    }
+}
+
+void Interpreter::load(std::string_view input, const Word *words, std::size_t count)
+{
+    original.assign(input.data(), input.length());
+    this->fold();
+    arguments.clear();
+    head        = 0;
+    rest_begin  = original.length();
+    rest_length = 0;
+    arguments.reserve(count);
+    for (std::size_t it = 0; it < count; ++it) {
+        arguments.emplace_back(
+            original.data(), words[it].begin, words[it].length, words[it].prefix, *configuration, folded.data());
+    }
+}
+
+void Interpreter::fold()
+{
+    folded.resize(original.length());
+    std::transform(original.begin(), original.end(), folded.begin(), ::fold);
+}
+
+void Interpreter::share(const vector_type &other)
+{
+    // The public copies of the arguments take their own copy of the text, these refer to the buffer instead.
+    arguments.clear();
+    arguments.reserve(other.size());
+    for (const auto &argument : other) {
+        arguments.push_back(Argument::share(argument));
+    }
+}
+
+void Interpreter::rebase(const char *previous, const char *previous_folded)
+{
+    for (auto &argument : arguments) {
+        if ((argument.source != nullptr) && (argument.source == previous)) {
+            argument.source = original.data();
+            if (argument.folded == previous_folded) {
+                argument.folded = folded.data();
+            }
+        }
+    }
+}
+
 auto Interpreter::operator[](const std::size_t &position) -> Argument &
 {
-    if (position >= arguments.size()) {
-        static Argument empty("");
+    if (position >= this->size()) {
+        // Every thread has its own placeholder, restored in case the caller modified it.
+        thread_local Argument empty("");
+        empty.parse("");
         return empty;
     }
-    return arguments[position];
+    return arguments[head + position];
 }
 
 auto Interpreter::operator[](const std::size_t &position) const -> const Argument &
 {
-    if (position >= arguments.size()) {
-        static Argument empty("");
+    if (position >= this->size()) {
+        // It cannot be modified, so all the threads can share it.
+        static const Argument empty("");
         return empty;
     }
-    return arguments[position];
+    return arguments[head + position];
 }
 
 } // namespace interpreter
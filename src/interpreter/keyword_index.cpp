@@ -0,0 +1,204 @@
+/// @file keyword_index.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the index which resolves arguments to the objects they name.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/keyword_index.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+namespace
+{
+
+/// @brief Turns an ASCII character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+/// @brief Provides a lowercase copy of a word.
+/// @param word the word.
+/// @return the lowercase word.
+inline auto folded(std::string_view word) -> std::string
+{
+    std::string result(word);
+    std::transform(result.begin(), result.end(), result.begin(), fold);
+    return result;
+}
+
+} // namespace
+
+namespace interpreter
+{
+
+KeywordIndex::KeywordIndex()
+    : sorted(0)
+    , count(0)
+{
+    // Nothing to do.
+}
+
+void KeywordIndex::insert(std::string_view keyword, std::uint32_t value)
+{
+    if (keyword.empty()) {
+        return;
+    }
+    // The keywords are sorted all together, when they are needed.
+    entries.push_back(Entry{folded(keyword), count++, value});
+}
+
+auto KeywordIndex::erase(std::string_view keyword, std::uint32_t value) -> bool
+{
+    this->build();
+    std::string key = folded(keyword);
+    auto first      = std::lower_bound(
+        entries.begin(), entries.end(), key, [](const Entry &entry, const std::string &other) {
+            return entry.keyword < other;
+        });
+    for (auto it = first; (it != entries.end()) && (it->keyword == key); ++it) {
+        if (it->value == value) {
+            entries.erase(it);
+            --sorted;
+            return true;
+        }
+    }
+    return false;
+}
+
+auto KeywordIndex::find(const Argument &argument, std::vector<std::uint32_t> &results) const -> std::size_t
+{
+    std::size_t quantity = argument.has_prefix_all() ? std::string::npos : argument.get_quantity();
+    return this->find(argument.get_content_view(), argument.get_index(), quantity, results);
+}
+
+auto KeywordIndex::find(
+    std::string_view word,
+    std::size_t index,
+    std::size_t quantity,
+    std::vector<std::uint32_t> &results) const -> std::size_t
+{
+    results.clear();
+    if (word.empty() || (index == 0) || (quantity == 0)) {
+        return 0;
+    }
+    this->build();
+    std::string key = folded(word);
+    // The keywords beginning with the word are contiguous.
+    auto first = std::lower_bound(
+        entries.cbegin(), entries.cend(), key,
+        [](const Entry &entry, const std::string &other) { return entry.keyword < other; });
+    auto last = std::partition_point(first, entries.cend(), [&key](const Entry &entry) {
+        return entry.keyword.compare(0, key.length(), key) == 0;
+    });
+    if (first == last) {
+        return 0;
+    }
+    if (first->keyword == (last - 1)->keyword) {
+        // A single keyword, its objects are already in order, and registered once.
+        auto matches = static_cast<std::size_t>(last - first);
+        if ((index - 1) >= matches) {
+            return 0;
+        }
+        std::size_t taken = std::min(quantity, matches - (index - 1));
+        results.reserve(taken);
+        for (auto it = first + static_cast<std::ptrdiff_t>(index - 1); taken > 0; ++it, --taken) {
+            results.push_back(it->value);
+        }
+        return results.size();
+    }
+    // Several keywords, each one with its objects in order: merge them only
+    // as far as needed, and count once the objects matching more than one.
+    using Run = std::pair<std::vector<Entry>::const_iterator, std::vector<Entry>::const_iterator>;
+    std::vector<Run> runs;
+    for (auto it = first; it != last;) {
+        auto end = std::upper_bound(
+            it, last, it->keyword, [](const std::string &other, const Entry &entry) { return other < entry.keyword; });
+        runs.emplace_back(it, end);
+        it = end;
+    }
+    auto later = [](const Run &lhs, const Run &rhs) { return lhs.first->order > rhs.first->order; };
+    std::make_heap(runs.begin(), runs.end(), later);
+    std::unordered_set<std::uint32_t> seen;
+    std::size_t skip = index - 1;
+    while (!runs.empty() && (results.size() < quantity)) {
+        std::pop_heap(runs.begin(), runs.end(), later);
+        std::uint32_t value = runs.back().first->value;
+        if (++runs.back().first == runs.back().second) {
+            runs.pop_back();
+        } else {
+            std::push_heap(runs.begin(), runs.end(), later);
+        }
+        if (!seen.insert(value).second) {
+            continue;
+        }
+        if (skip > 0) {
+            --skip;
+        } else {
+            results.push_back(value);
+        }
+    }
+    return results.size();
+}
+
+void KeywordIndex::build() const
+{
+    if (sorted == entries.size()) {
+        return;
+    }
+    auto by_keyword = [](const Entry &lhs, const Entry &rhs) {
+        int compare = lhs.keyword.compare(rhs.keyword);
+        return (compare < 0) || ((compare == 0) && (lhs.order < rhs.order));
+    };
+    // Sort the new keywords, and merge them with the others.
+    auto middle = entries.begin() + static_cast<std::ptrdiff_t>(sorted);
+    std::sort(middle, entries.end(), by_keyword);
+    std::inplace_merge(entries.begin(), middle, entries.end(), by_keyword);
+    // Keep only the first registration of an object with the same keyword.
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> objects;
+    std::vector<std::uint32_t> repeated;
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto end = std::find_if(it + 1, entries.end(), [it](const Entry &entry) { return entry.keyword != it->keyword; });
+        if ((end - it) > 1) {
+            objects.clear();
+            for (auto entry = it; entry != end; ++entry) {
+                objects.emplace_back(entry->value, entry->order);
+            }
+            std::sort(objects.begin(), objects.end());
+            for (std::size_t object = 1; object < objects.size(); ++object) {
+                if (objects[object].first == objects[object - 1].first) {
+                    repeated.push_back(objects[object].second);
+                }
+            }
+        }
+        it = end;
+    }
+    if (!repeated.empty()) {
+        std::sort(repeated.begin(), repeated.end());
+        entries.erase(
+            std::remove_if(
+                entries.begin(), entries.end(),
+                [&repeated](const Entry &entry) {
+                    return std::binary_search(repeated.begin(), repeated.end(), entry.order);
+                }),
+            entries.end());
+    }
+    sorted = entries.size();
+}
+
+void KeywordIndex::clear()
+{
+    entries.clear();
+    sorted = 0;
+    count  = 0;
+}
+
+auto KeywordIndex::size() const -> std::size_t
+{
+    this->build();
+    return entries.size();
+}
+
+} // namespace interpreter
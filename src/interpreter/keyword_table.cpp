@@ -0,0 +1,283 @@
+/// @file keyword_table.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the table of keywords, matched against an argument all at once.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/keyword_table.hpp"
+#include "interpreter/cpu.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#if defined(MUDINT_X86)
+#define MUDINT_KEYWORD_TABLE_SSE2
+#include <immintrin.h>
+#elif defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MUDINT_KEYWORD_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+/// @brief Turns an ASCII character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+/// @brief Provides the position of the lowest bit set.
+/// @param mask the mask, which must not be 0.
+/// @return the position of the bit.
+inline auto lowest_bit(std::uint32_t mask) -> std::size_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+    std::size_t bit = 0;
+    while ((mask & (std::uint32_t(1) << bit)) == 0) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+/// @brief Function which compares the first characters of a word with the keywords of a block.
+/// @details The keywords are padded with '\0', so the shorter ones do not match.
+using match_fn = std::uint32_t (*)(const char *, const char *, std::size_t);
+
+static_assert(interpreter::KeywordTable::lanes == 32, "A block must fill a 32-bit mask.");
+
+/// @brief The longest word folded on the stack, the others are folded on the heap.
+constexpr std::size_t fold_capacity = 64;
+
+/// @brief Compares the first characters of a word with the keywords of a block, one keyword at a time.
+/// @param block the columns of the block.
+/// @param word the characters of the word, none of them is '\0'.
+/// @param length the number of characters, at most KeywordTable::width.
+/// @return one bit for each keyword of the block which begins with the characters.
+auto match_block_scalar(const char *block, const char *word, std::size_t length) -> std::uint32_t
+{
+    std::uint32_t mask = UINT32_MAX;
+    for (std::size_t column = 0; (column < length) && (mask != 0); ++column) {
+        const char *cells = block + (column * interpreter::KeywordTable::lanes);
+        for (std::size_t lane = 0; lane < interpreter::KeywordTable::lanes; ++lane) {
+            if (cells[lane] != word[column]) {
+                mask &= ~(std::uint32_t(1) << lane);
+            }
+        }
+    }
+    return mask;
+}
+
+#ifdef MUDINT_KEYWORD_TABLE_SSE2
+
+/// @brief Compares the first characters of a word with the keywords of a block, 16 keywords at a time.
+/// @param block the columns of the block.
+/// @param word the characters of the word, none of them is '\0'.
+/// @param length the number of characters, at most KeywordTable::width.
+/// @return one bit for each keyword of the block which begins with the characters.
+auto match_block_sse2(const char *block, const char *word, std::size_t length) -> std::uint32_t
+{
+    std::uint32_t mask = UINT32_MAX;
+    for (std::size_t column = 0; (column < length) && (mask != 0); ++column) {
+        const char *cells  = block + (column * interpreter::KeywordTable::lanes);
+        __m128i character  = _mm_set1_epi8(word[column]);
+        __m128i low        = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cells)), character);
+        __m128i high       = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cells + 16)), character);
+        mask &= static_cast<std::uint32_t>(_mm_movemask_epi8(low)) |
+                (static_cast<std::uint32_t>(_mm_movemask_epi8(high)) << 16U);
+    }
+    return mask;
+}
+
+#endif
+
+#ifdef MUDINT_X86
+
+/// @brief Compares the first characters of a word with the keywords of a block, all of them at once.
+/// @param block the columns of the block.
+/// @param word the characters of the word, none of them is '\0'.
+/// @param length the number of characters, at most KeywordTable::width.
+/// @return one bit for each keyword of the block which begins with the characters.
+MUDINT_TARGET_AVX2 auto match_block_avx2(const char *block, const char *word, std::size_t length) -> std::uint32_t
+{
+    std::uint32_t mask = UINT32_MAX;
+    for (std::size_t column = 0; (column < length) && (mask != 0); ++column) {
+        const char *cells = block + (column * interpreter::KeywordTable::lanes);
+        __m256i equal     = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cells)), _mm256_set1_epi8(word[column]));
+        mask &= static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+    }
+    return mask;
+}
+
+#endif
+
+/// @brief Selects the best comparison for this processor.
+/// @return the function, and its name.
+auto select_implementation() -> std::pair<match_fn, const char *>
+{
+#if defined(MUDINT_X86)
+    if (interpreter::cpu::has_avx2()) {
+        return {match_block_avx2, "avx2"};
+    }
+    return {match_block_sse2, "sse2"};
+#elif defined(MUDINT_KEYWORD_TABLE_SSE2)
+    return {match_block_sse2, "sse2"};
+#else
+    return {match_block_scalar, "scalar"};
+#endif
+}
+
+/// @brief Provides the comparison selected for this processor, chosen once.
+/// @return the function, and its name.
+auto get_selected() -> std::pair<match_fn, const char *> &
+{
+    static std::pair<match_fn, const char *> selected = select_implementation();
+    return selected;
+}
+
+/// @brief Checks if a word is an abbreviation of a keyword.
+/// @param word the word, lowercase if the check is case-insensitive.
+/// @param keyword the keyword.
+/// @param sensitive enables case-sensitive check.
+/// @param from the first character to compare.
+/// @return true if the keyword begins with the word.
+inline auto abbreviates(std::string_view word, std::string_view keyword, bool sensitive, std::size_t from) -> bool
+{
+    if (word.length() > keyword.length()) {
+        return false;
+    }
+    for (std::size_t it = from; it < word.length(); ++it) {
+        if (word[it] != (sensitive ? keyword[it] : fold(keyword[it]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace interpreter
+{
+
+KeywordTable::KeywordTable(const std::vector<std::string> &_keywords)
+{
+    for (const auto &keyword : _keywords) {
+        this->insert(keyword);
+    }
+}
+
+auto KeywordTable::insert(std::string_view keyword) -> std::uint32_t
+{
+    auto position = static_cast<std::uint32_t>(keywords.size());
+    std::size_t lane = position % lanes;
+    if (lane == 0) {
+        // Start a new block, padded with '\0'.
+        columns.resize(columns.size() + (width * lanes), '\0');
+        folded_columns.resize(folded_columns.size() + (width * lanes), '\0');
+    }
+    std::size_t block = (position / lanes) * (width * lanes);
+    for (std::size_t column = 0; (column < width) && (column < keyword.length()); ++column) {
+        columns[block + (column * lanes) + lane]        = keyword[column];
+        folded_columns[block + (column * lanes) + lane] = fold(keyword[column]);
+    }
+    keywords.emplace_back(keyword);
+    return position;
+}
+
+auto KeywordTable::match(
+    const Argument &argument,
+    std::vector<std::uint32_t> &results,
+    bool sensitive,
+    std::size_t min_length) const -> std::size_t
+{
+    return this->match(argument.get_content_view(), results, sensitive, min_length);
+}
+
+auto KeywordTable::match(
+    std::string_view word,
+    std::vector<std::uint32_t> &results,
+    bool sensitive,
+    std::size_t min_length) const -> std::size_t
+{
+    results.clear();
+    if (word.empty() || (word.length() < min_length)) {
+        return 0;
+    }
+    // Fold the word once, on the stack unless it is too long.
+    char buffer[fold_capacity];
+    std::string lowercase;
+    if (!sensitive) {
+        if (word.length() <= fold_capacity) {
+            std::transform(word.begin(), word.end(), buffer, fold);
+            word = std::string_view(buffer, word.length());
+        } else {
+            lowercase.assign(word.data(), word.length());
+            std::transform(lowercase.begin(), lowercase.end(), lowercase.begin(), fold);
+            word = lowercase;
+        }
+    }
+    if (word.find('\0') != std::string_view::npos) {
+        // The padding would match, so compare one keyword at a time.
+        for (std::size_t position = 0; position < keywords.size(); ++position) {
+            if (abbreviates(word, keywords[position], sensitive, 0)) {
+                results.push_back(static_cast<std::uint32_t>(position));
+            }
+        }
+        return results.size();
+    }
+    const std::vector<char> &table = sensitive ? columns : folded_columns;
+    std::size_t prefix             = std::min(word.length(), width);
+    match_fn match_block           = get_selected().first;
+    for (std::size_t block = 0; (block * lanes) < keywords.size(); ++block) {
+        std::uint32_t mask = match_block(table.data() + (block * width * lanes), word.data(), prefix);
+        while (mask != 0) {
+            std::size_t position = (block * lanes) + lowest_bit(mask);
+            mask &= mask - 1;
+            // Only the words longer than the columns need to check the rest of the keyword.
+            if ((word.length() <= width) || abbreviates(word, keywords[position], sensitive, width)) {
+                results.push_back(static_cast<std::uint32_t>(position));
+            }
+        }
+    }
+    return results.size();
+}
+
+auto KeywordTable::get_implementation() -> const char * { return get_selected().second; }
+
+auto KeywordTable::set_implementation(std::string_view name) -> bool
+{
+    if (name == "scalar") {
+        get_selected() = {match_block_scalar, "scalar"};
+        return true;
+    }
+#ifdef MUDINT_KEYWORD_TABLE_SSE2
+    if (name == "sse2") {
+        get_selected() = {match_block_sse2, "sse2"};
+        return true;
+    }
+#endif
+#ifdef MUDINT_X86
+    if ((name == "avx2") && interpreter::cpu::has_avx2()) {
+        get_selected() = {match_block_avx2, "avx2"};
+        return true;
+    }
+#endif
+    return false;
+}
+
+auto KeywordTable::get_keyword(std::size_t position) const -> const std::string & { return keywords[position]; }
+
+void KeywordTable::clear()
+{
+    keywords.clear();
+    columns.clear();
+    folded_columns.clear();
+}
+
+auto KeywordTable::size() const -> std::size_t { return keywords.size(); }
+
+} // namespace interpreter
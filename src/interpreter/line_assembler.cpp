@@ -0,0 +1,167 @@
+/// @file line_assembler.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the assembler which turns the bytes read from a socket into lines.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/line_assembler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+/// @brief The telnet commands we need to recognize.
+enum : unsigned char {
+    TELNET_SE   = 240, ///< End of subnegotiation.
+    TELNET_SB   = 250, ///< Start of subnegotiation.
+    TELNET_WILL = 251, ///< Option negotiation, followed by the option.
+    TELNET_DONT = 254, ///< Option negotiation, followed by the option.
+    TELNET_IAC  = 255, ///< Interpret as command.
+};
+
+} // namespace
+
+namespace interpreter
+{
+
+LineAssembler::LineAssembler(std::size_t capacity)
+    : buffer(std::max<std::size_t>(capacity, 1))
+    , begin(0)
+    , end(0)
+    , line_start(0)
+    , scanned(0)
+    , state(State::data)
+{
+    // Nothing to do.
+}
+
+auto LineAssembler::prepare() -> char *
+{
+    if (begin == end) {
+        // Nothing is pending, start again from the front.
+        begin      = 0;
+        end        = 0;
+        line_start = 0;
+        scanned    = 0;
+    } else if (begin > 0) {
+        // Move the line being assembled to the front.
+        std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+        end -= begin;
+        line_start -= begin;
+        scanned -= begin;
+        begin = 0;
+    }
+    return buffer.data() + end;
+}
+
+auto LineAssembler::available() const -> std::size_t { return buffer.size() - end; }
+
+void LineAssembler::commit(std::size_t count)
+{
+    count = std::min(count, this->available());
+    // The cleaned bytes are never more than the ones read, so they are written in place.
+    char *text       = buffer.data();
+    std::size_t last = end + count;
+    for (std::size_t it = end; it < last; ++it) {
+        auto c = static_cast<unsigned char>(text[it]);
+        switch (state) {
+        case State::data:
+            if (c == TELNET_IAC) {
+                state = State::command;
+            } else if ((c == '\b') || (c == 127)) {
+                if (end > line_start) {
+                    --end;
+                    // The erased byte must be searched again, once replaced.
+                    scanned = std::min(scanned, end);
+                }
+            } else if ((c != '\r') && (c != '\0')) {
+                text[end++] = static_cast<char>(c);
+                if (c == '\n') {
+                    line_start = end;
+                }
+            }
+            break;
+        case State::command:
+            if (c == TELNET_IAC) {
+                // An escaped 255.
+                text[end++] = static_cast<char>(c);
+                state       = State::data;
+            } else if (c == TELNET_SB) {
+                state = State::subnegotiation;
+            } else if ((c >= TELNET_WILL) && (c <= TELNET_DONT)) {
+                state = State::option;
+            } else {
+                state = State::data;
+            }
+            break;
+        case State::option:
+            state = State::data;
+            break;
+        case State::subnegotiation:
+            if (c == TELNET_IAC) {
+                state = State::subcommand;
+            }
+            break;
+        case State::subcommand:
+            state = (c == TELNET_SE) ? State::data : State::subnegotiation;
+            break;
+        }
+    }
+}
+
+auto LineAssembler::append(std::string_view bytes) -> std::size_t
+{
+    char *destination = this->prepare();
+    std::size_t count = std::min(bytes.length(), this->available());
+    std::memcpy(destination, bytes.data(), count);
+    this->commit(count);
+    return count;
+}
+
+auto LineAssembler::next_line(std::string_view &line) -> bool
+{
+    const char *text = buffer.data();
+    const auto *found = static_cast<const char *>(std::memchr(text + scanned, '\n', end - scanned));
+    if (found == nullptr) {
+        scanned = end;
+        if ((begin == 0) && (end == buffer.size())) {
+            // The line does not fit, hand out what we have.
+            line       = std::string_view(text, end);
+            begin      = end;
+            line_start = end;
+            return true;
+        }
+        return false;
+    }
+    auto position = static_cast<std::size_t>(found - text);
+    line          = std::string_view(text + begin, position - begin);
+    begin         = position + 1;
+    scanned       = begin;
+    return true;
+}
+
+auto LineAssembler::next_lines(std::vector<std::string_view> &lines) -> std::size_t
+{
+    lines.clear();
+    std::string_view line;
+    while (this->next_line(line)) {
+        lines.push_back(line);
+    }
+    return lines.size();
+}
+
+auto LineAssembler::size() const -> std::size_t { return end - begin; }
+
+void LineAssembler::clear()
+{
+    begin      = 0;
+    end        = 0;
+    line_start = 0;
+    scanned    = 0;
+    state      = State::data;
+}
+
+} // namespace interpreter
@@ -0,0 +1,29 @@
+/// @file option_set.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the options an argument can be mapped to.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/option_set.hpp"
+
+namespace interpreter
+{
+
+OptionSet::OptionSet(const std::vector<Option> &options, std::size_t min_length)
+{
+    for (const auto &option : options) {
+        for (const auto &name : option.names) {
+            index.insert(name, option.option, min_length);
+        }
+    }
+    index.build();
+}
+
+auto OptionSet::find(std::string_view word) const -> unsigned
+{
+    std::uint32_t option = index.find(word);
+    return (option == PrefixTrie::none) ? 0U : static_cast<unsigned>(option);
+}
+
+} // namespace interpreter
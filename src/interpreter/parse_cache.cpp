@@ -0,0 +1,138 @@
+/// @file parse_cache.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the cache of the parsed input lines.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/parse_cache.hpp"
+
+#include <algorithm>
+
+namespace interpreter
+{
+
+ParseCache::ParseCache(std::size_t capacity, std::size_t _shards)
+    : shard_capacity(0)
+{
+    if (_shards == 0) {
+        _shards = 1;
+    }
+    shard_capacity = std::max<std::size_t>((capacity + _shards - 1) / _shards, 1);
+    shards.reserve(_shards);
+    for (std::size_t it = 0; it < _shards; ++it) {
+        shards.push_back(std::make_unique<Shard>());
+        shards.back()->entries.reserve(shard_capacity);
+    }
+}
+
+auto ParseCache::parse(Interpreter &args, std::string_view input, bool ignore) -> bool
+{
+    args.refresh_config();
+    std::uint64_t version = args.configuration->get_version();
+    Shard &shard          = *shards[std::hash<std::string_view>()(input) % shards.size()];
+    auto &index           = shard.index[ignore ? 1 : 0];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = index.find(input);
+        if ((found != index.end()) && (shard.entries[found->second].version == version)) {
+            Entry &entry     = shard.entries[found->second];
+            entry.referenced = true;
+            args.load(entry.line, entry.words.data(), entry.words.size());
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    // Parse the line outside of the lock, then remember where its words are.
+    args.parse(input, ignore);
+    const char *base = args.original.data();
+    std::vector<Interpreter::Word> words;
+    words.reserve(args.size());
+    for (const Argument &argument : args) {
+        std::string_view original = argument.get_original_view();
+        std::string_view content  = argument.get_content_view();
+        unsigned flags = (argument.has_prefix_all() ? static_cast<unsigned>(Prefix::FLAG_ALL) : 0U) |
+                         (argument.has_quantity() ? static_cast<unsigned>(Prefix::FLAG_QUANTITY) : 0U) |
+                         (argument.has_index() ? static_cast<unsigned>(Prefix::FLAG_INDEX) : 0U);
+        words.push_back(Interpreter::Word{
+            static_cast<std::uint32_t>(original.data() - base), static_cast<std::uint32_t>(original.length()),
+            Prefix{
+                static_cast<std::size_t>(content.data() - original.data()), content.length(), argument.get_index(),
+                argument.get_quantity(), flags}});
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = index.find(input);
+    if (found != index.end()) {
+        // Another thread added the line meanwhile, or the configuration changed.
+        Entry &entry  = shard.entries[found->second];
+        entry.words   = std::move(words);
+        entry.version = version;
+        return false;
+    }
+    std::uint32_t slot;
+    if (shard.entries.size() < shard_capacity) {
+        slot = static_cast<std::uint32_t>(shard.entries.size());
+        shard.entries.push_back(Entry{std::string(input), std::move(words), version, ignore, false});
+    } else {
+        // Give a second chance to the lines used since the hand last passed by.
+        while (shard.entries[shard.hand].referenced) {
+            shard.entries[shard.hand].referenced = false;
+            shard.hand                           = (shard.hand + 1) % shard_capacity;
+        }
+        slot         = static_cast<std::uint32_t>(shard.hand);
+        shard.hand   = (shard.hand + 1) % shard_capacity;
+        Entry &entry = shard.entries[slot];
+        shard.index[entry.ignore ? 1 : 0].erase(entry.line);
+        entry.line.assign(input.data(), input.length());
+        entry.words      = std::move(words);
+        entry.version    = version;
+        entry.ignore     = ignore;
+        entry.referenced = false;
+    }
+    index.emplace(shard.entries[slot].line, slot);
+    return false;
+}
+
+void ParseCache::clear()
+{
+    for (auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->index[0].clear();
+        shard->index[1].clear();
+        shard->entries.clear();
+        shard->hand = 0;
+    }
+}
+
+auto ParseCache::get_hits() const -> std::uint64_t
+{
+    std::uint64_t result = 0;
+    for (const auto &shard : shards) {
+        result += shard->hits.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+auto ParseCache::get_misses() const -> std::uint64_t
+{
+    std::uint64_t result = 0;
+    for (const auto &shard : shards) {
+        result += shard->misses.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+auto ParseCache::size() const -> std::size_t
+{
+    std::size_t result = 0;
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        result += shard->entries.size();
+    }
+    return result;
+}
+
+auto ParseCache::capacity() const -> std::size_t { return shard_capacity * shards.size(); }
+
+} // namespace interpreter
@@ -0,0 +1,154 @@
+/// @file pipeline.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the pipeline, which parses the input of a tick on many threads.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/pipeline.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+/// The number of chunks each worker starts with, more chunks balance better but lock more often.
+constexpr std::size_t chunks_per_worker = 8;
+
+} // namespace
+
+namespace interpreter
+{
+
+Pipeline::Pipeline(std::size_t workers)
+{
+    if (workers == 0) {
+        workers = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    for (std::size_t it = 0; it < workers; ++it) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (std::size_t it = 1; it < workers; ++it) {
+        threads.emplace_back(&Pipeline::run, this, it);
+    }
+}
+
+Pipeline::~Pipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+void Pipeline::parse(const std::string_view *_lines, std::size_t count, bool _ignore, std::vector<Interpreter> &_results)
+{
+    _results.resize(count);
+    if (count == 0) {
+        return;
+    }
+    // Split the lines into chunks, each worker gets a contiguous share.
+    std::size_t chunk = std::max<std::size_t>(1, count / (queues.size() * chunks_per_worker));
+    std::size_t share = (count + queues.size() - 1) / queues.size();
+    for (std::size_t worker = 0; worker < queues.size(); ++worker) {
+        Queue &queue = *queues[worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.clear();
+        queue.head = 0;
+        std::size_t end = std::min(count, (worker + 1) * share);
+        for (std::size_t begin = worker * share; begin < end; begin += chunk) {
+            queue.ranges.push_back(Range{begin, std::min(end, begin + chunk)});
+        }
+    }
+    // Start the tick.
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        lines         = _lines;
+        results       = _results.data();
+        ignore        = _ignore;
+        configuration = config::snapshot();
+        pending       = threads.size();
+        ++generation;
+    }
+    wake.notify_all();
+    // Work as the first worker, then wait for the others.
+    this->work(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]() { return pending == 0; });
+}
+
+void Pipeline::parse(const std::vector<std::string> &_lines, bool _ignore, std::vector<Interpreter> &_results)
+{
+    std::vector<std::string_view> views(_lines.begin(), _lines.end());
+    this->parse(views.data(), views.size(), _ignore, _results);
+}
+
+auto Pipeline::size() const -> std::size_t { return queues.size(); }
+
+void Pipeline::run(std::size_t worker)
+{
+    std::uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen]() { return stopping || (generation != seen); });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        this->work(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) {
+                done.notify_one();
+            }
+        }
+    }
+}
+
+void Pipeline::work(std::size_t worker)
+{
+    Range range{0, 0};
+    while (this->pop(worker, range) || this->steal(worker, range)) {
+        for (std::size_t it = range.begin; it < range.end; ++it) {
+            Interpreter &args = results[it];
+            // Use the snapshot of the tick without pinning it, the interpreters given their own keep it.
+            if (!args.pinned && (args.configuration != configuration)) {
+                args.configuration = configuration;
+            }
+            args.split(lines[it], ignore, std::string_view::npos);
+        }
+    }
+}
+
+auto Pipeline::pop(std::size_t worker, Range &range) -> bool
+{
+    Queue &queue = *queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head == queue.ranges.size()) {
+        return false;
+    }
+    range = queue.ranges[queue.head++];
+    return true;
+}
+
+auto Pipeline::steal(std::size_t worker, Range &range) -> bool
+{
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        Queue &queue = *queues[(worker + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.head < queue.ranges.size()) {
+            range = queue.ranges.back();
+            queue.ranges.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace interpreter
@@ -0,0 +1,108 @@
+/// @file prefix.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the evaluation of the index and quantity prefixes.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/prefix.hpp"
+
+#include <charconv>
+#include <climits>
+
+namespace
+{
+
+/// @brief Evaluates one of the prefixes, and removes it from the content.
+/// @param word the word.
+/// @param prefix the prefixes evaluated so far.
+/// @param pos the position of the first symbol inside the word, or npos.
+/// @param symbols the symbols of this prefix.
+/// @param flag the flag of this prefix.
+/// @param value where the number is stored.
+/// @param config the configuration.
+void evaluate_one(
+    std::string_view word,
+    interpreter::Prefix &prefix,
+    std::size_t pos,
+    std::string_view symbols,
+    unsigned flag,
+    std::size_t &value,
+    const interpreter::Config &config)
+{
+    std::string_view content = word.substr(prefix.content_begin, prefix.content_length);
+    // The number can start with a sign, which std::from_chars does not accept.
+    std::size_t sign = (!content.empty() && ((content[0] == '+') || (content[0] == '-'))) ? 1 : 0;
+    // Read the leading digits once, an overflow is reported instead of wrapping around.
+    std::size_t number = 0;
+    auto result        = std::from_chars(content.data() + sign, content.data() + content.length(), number);
+    auto digits        = static_cast<std::size_t>(result.ptr - content.data());
+    // Without digits, the sign alone is not a number.
+    if (digits == sign) {
+        digits = 0;
+    }
+    // If the entire string is a number, skip it.
+    if (!content.empty() && (digits == content.length())) {
+        return;
+    }
+    // Otherwise try to find a number if there is one.
+    if (pos == std::string_view::npos) {
+        return;
+    }
+    if (pos < prefix.content_begin) {
+        // The symbol was removed together with the other prefix, look for the next one.
+        pos = content.find_first_of(symbols);
+        if (pos == std::string_view::npos) {
+            return;
+        }
+    } else {
+        pos -= prefix.content_begin;
+    }
+    // Check that the symbol follows the digits.
+    if ((pos > 0) && (digits == pos)) {
+        // Negative numbers are dropped as well, since they cannot be an index nor a quantity.
+        if ((result.ec == std::errc()) && (number < INT_MAX) && ((content[0] != '-') || (number == 0))) {
+            // Set the number.
+            value = number;
+            // Set the prefix flag.
+            prefix.flags |= flag;
+        }
+        // Remove the digits.
+        prefix.content_begin += pos + 1;
+        prefix.content_length -= pos + 1;
+    } else if (config.means_all(content.substr(0, pos))) {
+        // Remove the quantity.
+        prefix.content_begin += pos + 1;
+        prefix.content_length -= pos + 1;
+        // Set the prefix flag.
+        prefix.flags |= interpreter::Prefix::FLAG_ALL;
+    }
+}
+
+} // namespace
+
+namespace interpreter
+{
+
+auto Prefix::evaluate(std::string_view word, std::size_t index_pos, std::size_t quantity_pos, const Config &config)
+    -> Prefix
+{
+    Prefix prefix{0, word.length(), 1, 1, 0};
+    // Without symbols there cannot be any prefix.
+    if ((index_pos == std::string_view::npos) && (quantity_pos == std::string_view::npos)) {
+        return prefix;
+    }
+    // Evaluate which one comes first.
+    if (index_pos < quantity_pos) {
+        evaluate_one(word, prefix, index_pos, config.get_symbols_index(), FLAG_INDEX, prefix.index, config);
+        evaluate_one(
+            word, prefix, quantity_pos, config.get_symbols_multiplier(), FLAG_QUANTITY, prefix.quantity, config);
+    } else {
+        evaluate_one(
+            word, prefix, quantity_pos, config.get_symbols_multiplier(), FLAG_QUANTITY, prefix.quantity, config);
+        evaluate_one(word, prefix, index_pos, config.get_symbols_index(), FLAG_INDEX, prefix.index, config);
+    }
+    return prefix;
+}
+
+} // namespace interpreter
@@ -0,0 +1,147 @@
+/// @file prefix_trie.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the trie which resolves words and their abbreviations.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/prefix_trie.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+/// @brief Turns the character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+} // namespace
+
+namespace interpreter
+{
+
+PrefixTrie::PrefixTrie()
+    : dirty(false)
+    , count(0)
+{
+    this->clear();
+}
+
+void PrefixTrie::insert(std::string_view key, std::uint32_t value, std::size_t min_length, int priority)
+{
+    if (key.empty()) {
+        return;
+    }
+    if ((min_length == 0) || (min_length > key.length())) {
+        min_length = key.length();
+    }
+    Candidate candidate{value, priority, count++};
+    std::uint32_t node = 0;
+    for (std::size_t depth = 0; depth < key.length(); ++depth) {
+        char symbol = fold(key[depth]);
+        // Look for the child, or create it.
+        std::uint32_t child = building[node].first_child;
+        while ((child != none) && (building[child].symbol != symbol)) {
+            child = building[child].next_sibling;
+        }
+        if (child == none) {
+            child = static_cast<std::uint32_t>(building.size());
+            building.push_back(BuildNode{
+                symbol, none, building[node].first_child, Candidate{none, 0, 0}, Candidate{none, 0, 0}});
+            building[node].first_child = child;
+        }
+        node = child;
+        // Every prefix at least `min_length` long is an abbreviation of the key.
+        if (((depth + 1) >= min_length) && is_better(candidate, building[node].abbreviation)) {
+            building[node].abbreviation = candidate;
+        }
+    }
+    if (is_better(candidate, building[node].exact)) {
+        building[node].exact = candidate;
+    }
+    dirty = true;
+}
+
+void PrefixTrie::build() const
+{
+    if (dirty) {
+        this->flatten();
+        dirty = false;
+    }
+}
+
+auto PrefixTrie::find(std::string_view word) const -> std::uint32_t
+{
+    if (word.empty()) {
+        return none;
+    }
+    this->build();
+    std::uint32_t node = 0;
+    for (char c : word) {
+        char symbol       = fold(c);
+        const Node &outer = nodes[node];
+        std::uint32_t it  = outer.first_child;
+        std::uint32_t end = outer.first_child + outer.children;
+        while ((it < end) && (nodes[it].symbol < symbol)) {
+            ++it;
+        }
+        if ((it == end) || (nodes[it].symbol != symbol)) {
+            return none;
+        }
+        node = it;
+    }
+    return nodes[node].value;
+}
+
+void PrefixTrie::clear()
+{
+    building.assign(1, BuildNode{'\0', none, none, Candidate{none, 0, 0}, Candidate{none, 0, 0}});
+    nodes.assign(1, Node{'\0', 1, 0, none});
+    dirty = false;
+    count = 0;
+}
+
+auto PrefixTrie::size() const -> std::size_t { return count; }
+
+void PrefixTrie::flatten() const
+{
+    nodes.clear();
+    nodes.reserve(building.size());
+    nodes.push_back(Node{'\0', 0, 0, none});
+    // Visit the nodes breadth-first, so that the children of a node are contiguous.
+    std::vector<std::uint32_t> queue(1, 0);
+    std::vector<std::uint32_t> children;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        std::uint32_t source = queue[head];
+        children.clear();
+        for (std::uint32_t child = building[source].first_child; child != none; child = building[child].next_sibling) {
+            children.push_back(child);
+        }
+        std::sort(children.begin(), children.end(), [this](std::uint32_t lhs, std::uint32_t rhs) {
+            return building[lhs].symbol < building[rhs].symbol;
+        });
+        nodes[head].first_child = static_cast<std::uint32_t>(nodes.size());
+        nodes[head].children    = static_cast<std::uint32_t>(children.size());
+        for (std::uint32_t child : children) {
+            const BuildNode &node = building[child];
+            std::uint32_t value   = (node.exact.value != none) ? node.exact.value : node.abbreviation.value;
+            nodes.push_back(Node{node.symbol, 0, 0, value});
+            queue.push_back(child);
+        }
+    }
+}
+
+auto PrefixTrie::is_better(const Candidate &candidate, const Candidate &current) -> bool
+{
+    if (current.value == none) {
+        return true;
+    }
+    if (candidate.priority != current.priority) {
+        return candidate.priority > current.priority;
+    }
+    return candidate.order < current.order;
+}
+
+} // namespace interpreter
@@ -0,0 +1,207 @@
+/// @file sharded_runtime.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the runtime which runs the sessions on several shards.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/sharded_runtime.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+/// The number of idle iterations a shard spins before it starts yielding its core.
+constexpr std::size_t spins_before_yield = 64;
+
+} // namespace
+
+namespace interpreter
+{
+
+ShardedRuntime::Shard::Shard(ShardedRuntime &_runtime, std::size_t _index, std::size_t cache_capacity)
+    : runtime(&_runtime)
+    , index(_index)
+    , args()
+    , configuration()
+    , cache(cache_capacity, 1)
+    , overflow()
+    , overflowing(0)
+    , executed(0)
+    , received(0)
+    , thread()
+{
+    // Nothing to do.
+}
+
+auto ShardedRuntime::Shard::get_index() const -> std::size_t { return index; }
+
+auto ShardedRuntime::Shard::execute(std::uint32_t session, std::string_view line, bool ignore) -> bool
+{
+    cache.parse(args, line, ignore);
+    executed.fetch_add(1, std::memory_order_relaxed);
+    return runtime->handler(*this, session, args);
+}
+
+void ShardedRuntime::Shard::send(std::uint32_t session, std::string text)
+{
+    std::size_t target = runtime->shard_of(session);
+    if (target == index) {
+        this->receive(session, text);
+        return;
+    }
+    // Keep the order of the messages, the ones already waiting go first.
+    Message message{session, std::move(text)};
+    if (overflow[target].empty() &&
+        runtime->queues[(index * runtime->shards.size()) + target]->try_push(std::move(message))) {
+        return;
+    }
+    overflow[target].push_back(std::move(message));
+    ++overflowing;
+}
+
+auto ShardedRuntime::Shard::get_config() const -> const std::shared_ptr<const Config> & { return configuration; }
+
+auto ShardedRuntime::Shard::get_cache() -> ParseCache & { return cache; }
+
+auto ShardedRuntime::Shard::get_executed() const -> std::uint64_t { return executed.load(std::memory_order_relaxed); }
+
+auto ShardedRuntime::Shard::get_received() const -> std::uint64_t { return received.load(std::memory_order_relaxed); }
+
+void ShardedRuntime::Shard::refresh()
+{
+    // Load the snapshot only when a new one was installed, otherwise it is a single atomic read.
+    if (!configuration || (configuration->get_version() != config::get_version())) {
+        configuration = config::snapshot();
+        args.set_config(configuration);
+    }
+}
+
+auto ShardedRuntime::Shard::deliver() -> bool
+{
+    bool moved        = false;
+    std::size_t count = runtime->shards.size();
+    Message message;
+    for (std::size_t source = 0; source < count; ++source) {
+        if (source == index) {
+            continue;
+        }
+        SpscQueue<Message> &queue = *runtime->queues[(source * count) + index];
+        while (queue.try_pop(message)) {
+            this->receive(message.session, message.text);
+            moved = true;
+        }
+    }
+    if (overflowing == 0) {
+        return moved;
+    }
+    for (std::size_t target = 0; target < count; ++target) {
+        std::deque<Message> &waiting = overflow[target];
+        SpscQueue<Message> &queue    = *runtime->queues[(index * count) + target];
+        while (!waiting.empty() && queue.try_push(std::move(waiting.front()))) {
+            waiting.pop_front();
+            --overflowing;
+            moved = true;
+        }
+    }
+    return moved;
+}
+
+void ShardedRuntime::Shard::receive(std::uint32_t session, std::string_view text)
+{
+    received.fetch_add(1, std::memory_order_relaxed);
+    runtime->receiver(*this, session, text);
+}
+
+void ShardedRuntime::Shard::run()
+{
+    std::size_t idle = 0;
+    while (!runtime->stopping.load(std::memory_order_relaxed)) {
+        this->refresh();
+        bool busy = runtime->poller(*this);
+        busy      = this->deliver() || busy;
+        if (busy) {
+            idle = 0;
+        } else if (++idle > spins_before_yield) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+ShardedRuntime::ShardedRuntime(
+    std::size_t count,
+    Handler _handler,
+    Receiver _receiver,
+    Poller _poller,
+    std::size_t queue_capacity,
+    std::size_t cache_capacity)
+    : shards()
+    , queues()
+    , handler(std::move(_handler))
+    , receiver(std::move(_receiver))
+    , poller(std::move(_poller))
+    , stopping(false)
+{
+    if (count == 0) {
+        count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    for (std::size_t it = 0; it < count; ++it) {
+        shards.push_back(std::make_unique<Shard>(*this, it, cache_capacity));
+        shards.back()->overflow.resize(count);
+    }
+    // The queue of a shard towards itself is never used, but keeps the indexing simple.
+    for (std::size_t it = 0; it < (count * count); ++it) {
+        queues.push_back(std::make_unique<SpscQueue<Message>>(((it / count) == (it % count)) ? 0 : queue_capacity));
+    }
+    // Start the threads only once everything they use is in place.
+    for (auto &shard : shards) {
+        shard->thread = std::thread(&Shard::run, shard.get());
+    }
+}
+
+ShardedRuntime::~ShardedRuntime() { this->stop(); }
+
+void ShardedRuntime::stop()
+{
+    stopping.store(true, std::memory_order_relaxed);
+    for (auto &shard : shards) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+    // Deliver the messages still travelling, now that no shard is running.
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        for (auto &shard : shards) {
+            moved = shard->deliver() || moved;
+        }
+    }
+}
+
+auto ShardedRuntime::shard_of(std::uint32_t session) const -> std::size_t { return session % shards.size(); }
+
+auto ShardedRuntime::get_shard(std::size_t position) -> Shard & { return *shards[position]; }
+
+auto ShardedRuntime::size() const -> std::size_t { return shards.size(); }
+
+auto ShardedRuntime::get_executed() const -> std::uint64_t
+{
+    std::uint64_t result = 0;
+    for (const auto &shard : shards) {
+        result += shard->get_executed();
+    }
+    return result;
+}
+
+auto ShardedRuntime::get_received() const -> std::uint64_t
+{
+    std::uint64_t result = 0;
+    for (const auto &shard : shards) {
+        result += shard->get_received();
+    }
+    return result;
+}
+
+} // namespace interpreter
@@ -0,0 +1,203 @@
+/// @file tokenizer.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the tokenizer, and its vectorized classification.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/tokenizer.hpp"
+#include "interpreter/cpu.hpp"
+
+#include <cstring>
+#include <utility>
+
+#ifdef MUDINT_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+
+/// @brief Function which classifies a whole block of text.
+using classify_fn = void (*)(const char *, std::string_view, std::string_view, interpreter::Tokenizer::Masks &);
+
+/// @brief Checks if the character is a whitespace.
+/// @param c the character.
+/// @return true if it is a space, a tab, a carriage return or a new line.
+inline auto is_space(char c) -> bool { return (c == ' ') || ((c >= '\t') && (c <= '\r')); }
+
+/// @brief Classifies a whole block, one byte at a time.
+void classify_scalar(
+    const char *block,
+    std::string_view index_symbols,
+    std::string_view quantity_symbols,
+    interpreter::Tokenizer::Masks &masks)
+{
+    masks = interpreter::Tokenizer::Masks{0, 0, 0};
+    for (std::size_t it = 0; it < interpreter::Tokenizer::block_size; ++it) {
+        std::uint64_t bit = std::uint64_t(1) << it;
+        if (is_space(block[it])) {
+            masks.space |= bit;
+        }
+        if (index_symbols.find(block[it]) != std::string_view::npos) {
+            masks.index |= bit;
+        }
+        if (quantity_symbols.find(block[it]) != std::string_view::npos) {
+            masks.quantity |= bit;
+        }
+    }
+}
+
+#ifdef MUDINT_X86
+
+/// @brief Builds the mask of the bytes equal to one of the symbols.
+/// @param chunk the bytes.
+/// @param symbols the symbols.
+/// @return the mask.
+inline auto sse2_match(__m128i chunk, std::string_view symbols) -> __m128i
+{
+    __m128i result = _mm_setzero_si128();
+    for (char symbol : symbols) {
+        result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(symbol)));
+    }
+    return result;
+}
+
+/// @brief Classifies a whole block, 16 bytes at a time.
+void classify_sse2(
+    const char *block,
+    std::string_view index_symbols,
+    std::string_view quantity_symbols,
+    interpreter::Tokenizer::Masks &masks)
+{
+    masks = interpreter::Tokenizer::Masks{0, 0, 0};
+    for (unsigned it = 0; it < 4; ++it) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + (it * 16U)));
+        // Tabs, new lines and carriage returns are the range [9, 13].
+        __m128i shifted = _mm_sub_epi8(chunk, _mm_set1_epi8('\t'));
+        __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(4)), shifted);
+        __m128i space   = _mm_or_si128(control, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')));
+        auto shift      = static_cast<unsigned>(it * 16U);
+        masks.space |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(space))) << shift;
+        masks.index |= static_cast<std::uint64_t>(
+                           static_cast<unsigned>(_mm_movemask_epi8(sse2_match(chunk, index_symbols))))
+                       << shift;
+        masks.quantity |= static_cast<std::uint64_t>(
+                              static_cast<unsigned>(_mm_movemask_epi8(sse2_match(chunk, quantity_symbols))))
+                          << shift;
+    }
+}
+
+/// @brief Builds the mask of the bytes equal to one of the symbols.
+/// @param chunk the bytes.
+/// @param symbols the symbols.
+/// @return the mask.
+MUDINT_TARGET_AVX2 inline auto avx2_match(__m256i chunk, std::string_view symbols) -> __m256i
+{
+    __m256i result = _mm256_setzero_si256();
+    for (char symbol : symbols) {
+        result = _mm256_or_si256(result, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(symbol)));
+    }
+    return result;
+}
+
+/// @brief Classifies a whole block, 32 bytes at a time.
+MUDINT_TARGET_AVX2 void classify_avx2(
+    const char *block,
+    std::string_view index_symbols,
+    std::string_view quantity_symbols,
+    interpreter::Tokenizer::Masks &masks)
+{
+    masks = interpreter::Tokenizer::Masks{0, 0, 0};
+    for (unsigned it = 0; it < 2; ++it) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + (it * 32U)));
+        // Tabs, new lines and carriage returns are the range [9, 13].
+        __m256i shifted = _mm256_sub_epi8(chunk, _mm256_set1_epi8('\t'));
+        __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(4)), shifted);
+        __m256i space   = _mm256_or_si256(control, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')));
+        auto shift      = static_cast<unsigned>(it * 32U);
+        masks.space |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm256_movemask_epi8(space))) << shift;
+        masks.index |= static_cast<std::uint64_t>(
+                           static_cast<unsigned>(_mm256_movemask_epi8(avx2_match(chunk, index_symbols))))
+                       << shift;
+        masks.quantity |= static_cast<std::uint64_t>(
+                              static_cast<unsigned>(_mm256_movemask_epi8(avx2_match(chunk, quantity_symbols))))
+                          << shift;
+    }
+}
+
+#endif
+
+/// @brief Selects the best classification for this processor.
+/// @return the function, and its name.
+auto select_implementation() -> std::pair<classify_fn, const char *>
+{
+#ifdef MUDINT_X86
+    if (interpreter::cpu::has_avx2()) {
+        return {classify_avx2, "avx2"};
+    }
+    return {classify_sse2, "sse2"};
+#else
+    return {classify_scalar, "scalar"};
+#endif
+}
+
+/// @brief Provides the classification selected for this processor, chosen once.
+/// @return the function, and its name.
+auto get_selected() -> std::pair<classify_fn, const char *> &
+{
+    static std::pair<classify_fn, const char *> selected = select_implementation();
+    return selected;
+}
+
+} // namespace
+
+namespace interpreter
+{
+
+Tokenizer::Tokenizer(std::string_view _index_symbols, std::string_view _quantity_symbols)
+    : index_symbols(_index_symbols)
+    , quantity_symbols(_quantity_symbols)
+{
+    // Nothing to do.
+}
+
+void Tokenizer::classify(const char *block, std::size_t length, Masks &masks) const
+{
+    classify_fn function = get_selected().first;
+    if (length == block_size) {
+        function(block, index_symbols, quantity_symbols, masks);
+        return;
+    }
+    // Copy the tail inside a padded block, so that we never read past the text.
+    char padded[block_size] = {};
+    std::memcpy(padded, block, length);
+    function(padded, index_symbols, quantity_symbols, masks);
+    std::uint64_t valid = (std::uint64_t(1) << length) - 1;
+    masks.space &= valid;
+    masks.index &= valid;
+    masks.quantity &= valid;
+}
+
+auto Tokenizer::get_implementation() -> const char * { return get_selected().second; }
+
+auto Tokenizer::set_implementation(std::string_view name) -> bool
+{
+    if (name == "scalar") {
+        get_selected() = {classify_scalar, "scalar"};
+        return true;
+    }
+#ifdef MUDINT_X86
+    if (name == "sse2") {
+        get_selected() = {classify_sse2, "sse2"};
+        return true;
+    }
+    if ((name == "avx2") && interpreter::cpu::has_avx2()) {
+        get_selected() = {classify_avx2, "avx2"};
+        return true;
+    }
+#endif
+    return false;
+}
+
+} // namespace interpreter
@@ -0,0 +1,128 @@
+/// @file word_set.cpp
+/// @author Enrico Fraccaroli (enry.frak@gmail.com)
+/// @brief Implements the set of words with case-insensitive lookup.
+/// @copyright
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "interpreter/word_set.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+/// @brief Turns an ASCII character lowercase.
+/// @param c the character.
+/// @return the lowercase character.
+inline auto fold(char c) -> char { return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+} // namespace
+
+namespace interpreter
+{
+
+WordSet::WordSet()
+    : slots(1, Slot{0, 0})
+    , seed(0)
+    , lengths(0)
+{
+    // Nothing to do.
+}
+
+WordSet::WordSet(const std::vector<std::string> &words)
+    : WordSet()
+{
+    this->assign(words);
+}
+
+void WordSet::assign(const std::vector<std::string> &words)
+{
+    // Fold the words, and remove the duplicates.
+    std::vector<std::string> folded;
+    folded.reserve(words.size());
+    for (const auto &word : words) {
+        if (!word.empty()) {
+            std::string entry(word);
+            std::transform(entry.begin(), entry.end(), entry.begin(), fold);
+            folded.push_back(entry);
+        }
+    }
+    std::sort(folded.begin(), folded.end());
+    folded.erase(std::unique(folded.begin(), folded.end()), folded.end());
+    // Store the words contiguously.
+    text.clear();
+    lengths = 0;
+    std::vector<Slot> entries;
+    for (const auto &word : folded) {
+        entries.push_back(Slot{static_cast<std::uint32_t>(text.length()), static_cast<std::uint32_t>(word.length())});
+        text.append(word);
+        lengths |= WordSet::length_bit(word.length());
+    }
+    // Look for a seed without collisions, growing the table when it takes too long.
+    std::size_t size = 1;
+    while (size < (entries.size() * 2)) {
+        size <<= 1U;
+    }
+    for (seed = 1;; ++seed) {
+        if ((seed % 64) == 0) {
+            size <<= 1U;
+        }
+        slots.assign(size, Slot{0, 0});
+        bool perfect = true;
+        for (const auto &entry : entries) {
+            std::string_view word(text.data() + entry.offset, entry.length);
+            std::size_t position = WordSet::hash(word, seed, true) & (size - 1);
+            if (slots[position].length != 0) {
+                perfect = false;
+                break;
+            }
+            slots[position] = entry;
+        }
+        if (perfect) {
+            break;
+        }
+    }
+}
+
+auto WordSet::contains(std::string_view word, bool folded) const -> bool
+{
+    if ((word.empty()) || ((lengths & WordSet::length_bit(word.length())) == 0)) {
+        return false;
+    }
+    const Slot &slot = slots[WordSet::hash(word, seed, folded) & (slots.size() - 1)];
+    if (slot.length != word.length()) {
+        return false;
+    }
+    const char *candidate = text.data() + slot.offset;
+    if (folded) {
+        return std::memcmp(word.data(), candidate, word.length()) == 0;
+    }
+    for (std::size_t it = 0; it < word.length(); ++it) {
+        if (fold(word[it]) != candidate[it]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto WordSet::empty() const -> bool { return text.empty(); }
+
+auto WordSet::hash(std::string_view word, std::uint64_t _seed, bool folded) -> std::uint64_t
+{
+    // FNV-1a, over the folded characters.
+    std::uint64_t result = 14695981039346656037ULL ^ (_seed * 0x9E3779B97F4A7C15ULL);
+    for (char c : word) {
+        result ^= static_cast<unsigned char>(folded ? c : fold(c));
+        result *= 1099511628211ULL;
+    }
+    return result ^ (result >> 29U);
+}
+
+auto WordSet::length_bit(std::size_t length) -> std::uint64_t
+{
+    return std::uint64_t(1) << ((length < 63) ? length : 63);
+}
+
+} // namespace interpreter
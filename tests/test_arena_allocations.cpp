@@ -0,0 +1,119 @@
+/// @file test_arena_allocations.cpp
+/// @brief Test that parsing does not allocate once the interpreter, or its arena, has warmed up.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <cstdlib>
+#include <new>
+
+/// The number of global allocations performed so far.
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (void *p = std::malloc(size != 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+/// The lines parsed at every tick.
+static const char *lines[] = {
+    "take 2*pen from the 3.box",
+    "look all.sword",
+    "say this is a line long enough to not fit inside the small string buffer of the standard library",
+    "put pen in box",
+};
+
+/// @brief Parses all the lines, as it would happen during one tick.
+static inline std::size_t tick(interpreter::Interpreter &args)
+{
+    std::size_t total = 0;
+    for (const char *line : lines) {
+        args.parse(line, true);
+        for (const auto &argument : args) {
+            total += argument.get_content_view().length() + argument.get_index() + argument.get_quantity();
+        }
+    }
+    return total;
+}
+
+int main()
+{
+    // A reused interpreter stops allocating once its buffers fit the input.
+    {
+        interpreter::Interpreter args;
+        tick(args);
+        std::size_t before = allocations;
+        for (int it = 0; it < 100; ++it) {
+            tick(args);
+        }
+        if (allocations != before) {
+            std::cerr << "Test failed! Reused interpreter performed " << (allocations - before) << " allocations."
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    // Interpreters bound to an arena only take memory from it, even when they are cleared at every tick.
+    {
+        interpreter::Arena arena(16384);
+        std::vector<interpreter::Interpreter> sessions;
+        sessions.reserve(8);
+        for (int it = 0; it < 8; ++it) {
+            sessions.emplace_back(arena);
+        }
+        // Warm up the arena.
+        for (auto &args : sessions) {
+            tick(args);
+            args.clear();
+        }
+        arena.reset();
+        std::size_t before = allocations;
+        for (int it = 0; it < 100; ++it) {
+            for (auto &args : sessions) {
+                tick(args);
+                args.clear();
+            }
+            arena.reset();
+        }
+        if (allocations != before) {
+            std::cerr << "Test failed! Arena-backed interpreters performed " << (allocations - before)
+                      << " allocations." << std::endl;
+            return 1;
+        }
+        // Parsing must still give the right result.
+        sessions[0].parse("take 2*pen from the 3.box", true);
+        if ((sessions[0].size() != 3) || (sessions[0][1].get_content_view() != "pen") ||
+            (sessions[0][2].get_index() != 3)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        // A copy does not take memory from the arena, so it survives the arena being reused.
+        interpreter::Interpreter copy(sessions[0]);
+        for (auto &args : sessions) {
+            args.clear();
+        }
+        arena.reset();
+        for (auto &args : sessions) {
+            tick(args);
+        }
+        if ((copy.size() != 3) || (copy.get_original_view() != "take 2*pen from the 3.box") ||
+            (copy[1].get_content_view() != "pen") || (copy[2].get_index() != 3)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        for (auto &args : sessions) {
+            args.clear();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/// @file test_argument_storage.cpp
+/// @brief Test the inline storage of the arguments, and that their accessors do not allocate.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <cstdlib>
+#include <new>
+
+/// The number of global allocations performed so far.
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (void *p = std::malloc(size != 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+static_assert(sizeof(interpreter::Argument) <= 64, "An argument must fit inside a cache line.");
+
+int main()
+{
+    // Warm up the configuration snapshot.
+    interpreter::Argument(std::string("warm"));
+
+    // Short words are kept inside the argument.
+    std::string word("2*sword");
+    std::size_t before = allocations;
+    interpreter::Argument argument(word);
+    interpreter::Argument copy(argument);
+    interpreter::Argument moved(std::move(copy));
+    copy = moved;
+    copy.set_content("shield");
+    if ((allocations != before) || (moved.get_content_view() != "sword") || (moved.get_quantity() != 2) ||
+        (copy.get_content_view() != "shield") || (copy.get_original_view() != "2*sword")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Long words go on the heap, and survive copies, moves and changes.
+    std::string long_word("3.averyveryverylongwordwhichdoesnotfit");
+    interpreter::Argument long_argument(long_word);
+    interpreter::Argument long_copy(long_argument);
+    long_copy.set_content(std::string(long_copy.get_content_view()) + "andevenlonger");
+    interpreter::Argument long_moved(std::move(long_argument));
+    long_moved[0] = 'A';
+    if ((long_moved.get_content_view() != "Averyveryverylongwordwhichdoesnotfit") || (long_moved.get_index() != 3) ||
+        (long_copy.get_content_view() != "averyveryverylongwordwhichdoesnotfitandevenlonger") ||
+        (long_copy.get_original_view() != long_word)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Shrinking back to a short content moves the text inside the argument again.
+    long_copy.set_content("x");
+    if ((long_copy.get_content_view() != "x") || (long_copy.get_original_view() != long_word)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Looking up the arguments does not allocate.
+    interpreter::Interpreter args;
+    args.parse("take the averyveryverylongsword from the 2.chest", false);
+    const std::string exact("averyveryverylongsword"), prefix("CHE");
+    before = allocations;
+    const interpreter::Argument *found_exact  = args.find(exact, true);
+    const interpreter::Argument *found_prefix = args.find(prefix, false);
+    bool abbreviation                         = args[2].is_abbreviation_of(exact, false, 3);
+    bool number                               = args[5].is_number();
+    if ((allocations != before) || (found_exact != &args[2]) || (found_prefix != &args[5]) || !abbreviation ||
+        number) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/// @file test_case_folding.cpp
+/// @brief Test that the case-insensitive comparisons give the same results, with or without the lowercase copy.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    interpreter::Interpreter args;
+
+    // The arguments of the interpreter compare their lowercase copy.
+    args.parse("Take the Golden.Key INTO ALL.Chests", true);
+    if ((args.size() != 4) || (args.find("GOLD") != &args[1]) || (args.find("into") != &args[2]) ||
+        (args.find("chest") != &args[3]) || (args.find("golden.key", true) != nullptr) ||
+        !args[0].is_abbreviation_of("TAKE", false, 2) || args[0].is_abbreviation_of("take", true) ||
+        !args[3].has_prefix_all() || !args[2].begins_with("In") || args[2].begins_with("in", true)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The words meaning all, and the ignored words, are found in any case.
+    args.parse("drop ALL The 3*THE", false);
+    if (!args[1].means_all()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.remove_ignored_words();
+    if (args.size() != 2) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Copies and moves keep referring to their own lowercase copy.
+    args.parse("Open DOOR", false);
+    interpreter::Interpreter copy(args);
+    interpreter::Interpreter moved(std::move(copy));
+    args.parse("close window", false);
+    if ((moved.find("DOOR") != &moved[1]) || (moved.find("open") != &moved[0])) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Arguments with their own text fold it while comparing.
+    moved[1].set_content("Gate");
+    interpreter::Argument alone("All.Coins");
+    if ((moved.find("GATE") != &moved[1]) || !moved[1].is_abbreviation_of("gates") || !alone.begins_with("COIN") ||
+        !alone.has_prefix_all()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Strings too long to be folded at once still match.
+    std::string word(100, 'A');
+    args.parse(("x " + word + "b").c_str(), false);
+    if ((args.find(std::string(100, 'a')) != &args[1]) || (args.find(word + "C") != nullptr)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/// @file test_command_queue.cpp
+/// @brief Test that the commands cross the queue in order, and that the sessions are throttled.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/command_queue.hpp>
+
+#include <atomic>
+#include <thread>
+
+int main()
+{
+    interpreter::CommandQueue queue(3, 3, 2);
+    interpreter::Interpreter args;
+    std::uint32_t session = 0;
+    if ((queue.capacity() != 4) || queue.pop(session, args)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The command is moved inside the queue, and the caller gets back an empty interpreter.
+    args.parse("take 2*pen from 3.box", false);
+    if ((queue.push(0, args) != interpreter::CommandQueue::Result::accepted) || !args.empty() ||
+        (queue.get_pending(0) != 1) || queue.is_throttled(0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // The session is throttled once it reaches its limit, the other one is not.
+    args.parse("look", false);
+    if ((queue.push(0, args) != interpreter::CommandQueue::Result::accepted) || !queue.is_throttled(0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("north", false);
+    if ((queue.push(0, args) != interpreter::CommandQueue::Result::session_full) || (args[0].get_content_view() != "north") ||
+        (queue.get_pending(0) != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // The queue fills up.
+    for (const char *line : {"say one", "say two"}) {
+        args.parse(line, false);
+        if (queue.push(1, args) != interpreter::CommandQueue::Result::accepted) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    interpreter::CommandQueue::Result result = queue.push(1, args);
+    if ((result != interpreter::CommandQueue::Result::session_full) || !queue.is_throttled(1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The sessions the queue was not built for are refused, leaving the command untouched.
+    args.parse("north", false);
+    if ((queue.push(3, args) != interpreter::CommandQueue::Result::bad_session) ||
+        (queue.push(UINT32_MAX, args) != interpreter::CommandQueue::Result::bad_session) ||
+        (args[0].get_content_view() != "north")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The commands come out in order, with their prefixes.
+    interpreter::Interpreter command;
+    if (!queue.pop(session, command) || (session != 0) || (command.size() != 4) || (command[1].get_content_view() != "pen") ||
+        (command[1].get_quantity() != 2) || (command[3].get_index() != 3) || queue.is_throttled(0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // The queue is full, even if the session is not.
+    args.parse("north", false);
+    if (queue.push(0, args) != interpreter::CommandQueue::Result::accepted) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("south", false);
+    if ((queue.push(1, args) != interpreter::CommandQueue::Result::session_full) ||
+        (queue.push(2, args) != interpreter::CommandQueue::Result::queue_full) || (queue.get_pending(2) != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    const std::vector<std::pair<std::uint32_t, std::string>> expected = {
+        {0, "look"}, {1, "say one"}, {1, "say two"}, {0, "north"}};
+    for (const auto &pair : expected) {
+        if (!queue.pop(session, command) || (session != pair.first) || (command.get_original_view() != pair.second)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    if (queue.pop(session, command) || (queue.get_pending(0) != 0) || (queue.get_pending(1) != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Several producers, each one with its own sessions, and a single consumer.
+    const std::size_t producers = 4;
+    const std::size_t per_thread = 20000;
+    const std::uint32_t limit    = 4;
+    interpreter::CommandQueue shared(64, producers * 2, limit);
+    std::vector<std::thread> threads;
+    for (std::size_t producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&shared, producer]() {
+            interpreter::Interpreter local;
+            for (std::size_t it = 0; it < per_thread; ++it) {
+                auto owner = static_cast<std::uint32_t>((producer * 2) + (it % 2));
+                local.parse(("take " + std::to_string(it / 2)).c_str(), false);
+                while (shared.push(owner, local) != interpreter::CommandQueue::Result::accepted) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<long> last(producers * 2, -1);
+    bool failed = false;
+    for (std::size_t received = 0; received < (producers * per_thread);) {
+        if (!shared.pop(session, command)) {
+            std::this_thread::yield();
+            continue;
+        }
+        long value = std::stol(command[1].get_content());
+        if (value != (last[session] + 1)) {
+            failed = true;
+        }
+        last[session] = value;
+        ++received;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    if (failed || shared.pop(session, command)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/// @file test_command_table.cpp
+/// @brief Test the resolution of commands and their abbreviations.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/command_table.hpp>
+
+/// @brief Checks that the word resolves to the given command.
+static inline bool resolves(const interpreter::CommandTable &table, const char *word, const char *expected)
+{
+    const interpreter::CommandTable::Command *command = table.find(word);
+    if (expected == nullptr) {
+        return command == nullptr;
+    }
+    return (command != nullptr) && (command->name == expected);
+}
+
+int main()
+{
+    interpreter::CommandTable table;
+    table.add("say", do_say);
+    table.add("look", do_look);
+    table.add("take", do_take);
+    table.add("put", do_put);
+    table.add("configure", do_configure, 3);
+    table.add("south", nullptr, 1, 10);
+    table.add("score", nullptr, 2);
+    table.add("sacrifice", nullptr, 2, 1);
+    table.add("putrefy", nullptr, 1, 5);
+
+    if (!resolves(table, "say", "say") || !resolves(table, "SAY", "say") || !resolves(table, "sa", "sacrifice") ||
+        !resolves(table, "s", "south") || !resolves(table, "sc", "score") || !resolves(table, "con", "configure") ||
+        !resolves(table, "co", nullptr) || !resolves(table, "configures", nullptr) || !resolves(table, "lo", nullptr) ||
+        !resolves(table, "put", "put") || !resolves(table, "pu", "putrefy") || !resolves(table, "", nullptr)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Commands registered after a lookup are taken into account by the next one.
+    table.add("sail", nullptr, 2, 2);
+    table.build();
+    if (!resolves(table, "sa", "sail") || !resolves(table, "SAIL", "sail") || !resolves(table, "sac", "sacrifice")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Dispatching removes the command, and runs its handler.
+    interpreter::Interpreter args;
+    std::string output;
+    capture_stdout(
+        [&]() {
+            args.parse("conf name", false);
+            table.dispatch(args);
+        },
+        output);
+    if (output.find("You selected name") == std::string::npos) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+/// @file test_command_task.cpp
+/// @brief Test that the coroutine handlers wait for ticks and input, and reuse their frames.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/command_task.hpp>
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)
+
+#include <stdexcept>
+
+/// The things given away, by session.
+static std::vector<std::string> given;
+
+/// @brief Asks for a confirmation, then gives the object away a couple of ticks later.
+static auto do_give(std::uint32_t session, interpreter::Interpreter args) -> interpreter::CommandTask
+{
+    interpreter::Interpreter *answer = co_await interpreter::wait_input(5);
+    if ((answer == nullptr) || !(*answer)[0].is_abbreviation_of("yes")) {
+        co_return false;
+    }
+    co_await interpreter::wait_ticks(2);
+    // The arguments are still inside the frame.
+    given.push_back(std::to_string(session) + ":" + args[0].get_content());
+    co_return true;
+}
+
+/// @brief Completes at once.
+static auto do_glance(std::uint32_t, interpreter::Interpreter args) -> interpreter::CommandTask
+{
+    co_return args.empty();
+}
+
+/// @brief Waits for some ticks.
+static auto do_rest(std::uint32_t, interpreter::Interpreter args) -> interpreter::CommandTask
+{
+    co_await interpreter::wait_ticks(static_cast<std::uint64_t>(std::stoul(args[0].get_content())));
+    co_return true;
+}
+
+/// @brief Fails after a tick.
+static auto do_fail(std::uint32_t, interpreter::Interpreter) -> interpreter::CommandTask
+{
+    co_await interpreter::wait_ticks(1);
+    throw std::runtime_error("failed");
+}
+
+int main()
+{
+    interpreter::CommandScheduler scheduler;
+    scheduler.add("give", do_give);
+    scheduler.add("look", do_glance);
+    scheduler.add("rest", do_rest);
+    scheduler.add("fail", do_fail);
+    interpreter::Interpreter args;
+
+    // The commands which do not wait complete at once.
+    args.parse("look", false);
+    if (!scheduler.dispatch(1, args) || (scheduler.size() != 0) || (scheduler.get_completed() != 1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("dance", false);
+    if (scheduler.dispatch(1, args)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The next line of the session answers the command, the other sessions are dispatched as usual.
+    args.parse("give sword", false);
+    if (!scheduler.dispatch(1, args) || (scheduler.size() != 1) || !scheduler.is_reading(1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("look", false);
+    if (!scheduler.dispatch(2, args) || (scheduler.size() != 1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("y", false);
+    if (!scheduler.dispatch(1, args) || scheduler.is_reading(1) || !given.empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // The stale timer of the confirmation, and the first tick, do not resume it.
+    scheduler.tick();
+    if (!given.empty() || (scheduler.tick() != 1) || (given != std::vector<std::string>{"1:sword"}) ||
+        (scheduler.size() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The confirmation expires.
+    args.parse("give shield", false);
+    scheduler.dispatch(3, args);
+    for (int it = 0; it < 4; ++it) {
+        scheduler.tick();
+    }
+    if (!scheduler.is_reading(3) || (scheduler.tick() != 1) || scheduler.is_reading(3) || (scheduler.size() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // A refusal completes the command, with its result.
+    args.parse("give apple", false);
+    scheduler.dispatch(4, args);
+    args.parse("no", false);
+    if (scheduler.dispatch(4, args) || (scheduler.size() != 0) || (given.size() != 1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The commands of a session which disconnects are destroyed where they wait.
+    args.parse("rest 2", false);
+    scheduler.dispatch(6, args);
+    args.parse("give sword", false);
+    scheduler.dispatch(6, args);
+    args.parse("rest 2", false);
+    scheduler.dispatch(7, args);
+    if ((scheduler.cancel(6) != 2) || scheduler.is_reading(6) || (scheduler.size() != 1) ||
+        (scheduler.cancel(6) != 0) || (scheduler.tick() != 0) || (scheduler.tick() != 1) ||
+        (scheduler.size() != 0) || (given.size() != 1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Its next line starts a new command.
+    args.parse("look", false);
+    if (!scheduler.dispatch(6, args) || (scheduler.size() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The exceptions reach the game loop, once the frame is gone.
+    args.parse("fail", false);
+    scheduler.dispatch(5, args);
+    try {
+        scheduler.tick();
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    } catch (const std::runtime_error &) {
+        if (scheduler.size() != 0) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+
+    // Thousands of commands in flight, resumed in the order of their ticks,
+    // and the second round reuses the frames of the first one.
+    for (int round = 0; round < 2; ++round) {
+        std::size_t allocated = interpreter::FramePool::local().get_allocated();
+        for (std::uint32_t session = 0; session < 5000; ++session) {
+            args.parse(("rest " + std::to_string(1 + (session % 3))).c_str(), false);
+            scheduler.dispatch(session, args);
+        }
+        if ((scheduler.size() != 5000) || (scheduler.tick() != 1667) || (scheduler.tick() != 1667) ||
+            (scheduler.tick() != 1666) || (scheduler.size() != 0)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        if ((round == 1) && (interpreter::FramePool::local().get_allocated() != allocated)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+
+    // A scheduler with static storage is destroyed after the pool of the
+    // thread, with a command still waiting for the input of its session.
+    static interpreter::CommandScheduler lasting;
+    lasting.add("give", do_give);
+    args.parse("give sword", false);
+    lasting.dispatch(1, args);
+    if (!lasting.is_reading(1)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    // The coroutines need C++20.
+    return 0;
+}
+
+#endif
@@ -0,0 +1,90 @@
+/// @file test_config_snapshot.cpp
+/// @brief Test the configuration snapshots, and reloading them while other threads parse.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <atomic>
+#include <thread>
+
+/// @brief Builds a configuration where "every" means "all", and also "#" specifies an index.
+static inline std::shared_ptr<const interpreter::Config> make_zone_config()
+{
+    return std::make_shared<const interpreter::Config>(
+        std::vector<std::string>{"all", "every"}, std::vector<std::string>{"from"}, "*", ".#");
+}
+
+int main()
+{
+    // Interpreters can use different configurations at the same time.
+    interpreter::Interpreter global_args;
+    interpreter::Interpreter zone_args(make_zone_config());
+    global_args.parse("take every.pen from 2#box", true);
+    zone_args.parse("take every.pen from 2#box", true);
+    if (global_args[1].has_prefix_all() || (global_args.size() != 3) || global_args[2].has_index()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if (!zone_args[1].has_prefix_all() || (zone_args.size() != 3) || !zone_args[2].has_index() ||
+        (zone_args[2].get_index() != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Replacing the configuration keeps the words already parsed as they were.
+    zone_args.parse("take every.pen from 2#box", true);
+    zone_args.set_config(std::make_shared<const interpreter::Config>(
+        std::vector<std::string>{"all"}, std::vector<std::string>{}, "*", "."));
+    if (!zone_args[1].has_prefix_all() || (zone_args[2].get_index() != 2) || (zone_args[2].get_content() != "box")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    zone_args.set_config(nullptr);
+    if (!zone_args[1].has_prefix_all() || (zone_args[1].get_content() != "pen")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Reload the global configuration while other threads are parsing.
+    std::atomic<bool> failed(false);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> workers;
+    for (int it = 0; it < 4; ++it) {
+        workers.emplace_back([&failed, &stop]() {
+            interpreter::Interpreter args;
+            while (!stop.load()) {
+                args.parse("take every.pen", false);
+                // Whatever snapshot was used, the whole line must agree with it.
+                if (args[1].has_prefix_all() != args.get_config().means_all("every")) {
+                    failed.store(true);
+                }
+            }
+        });
+    }
+    for (int it = 0; it < 200; ++it) {
+        if ((it % 2) == 0) {
+            interpreter::config::install(make_zone_config());
+        } else {
+            interpreter::config::update();
+        }
+    }
+    stop.store(true);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (failed.load()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The last snapshot installed is picked up by the next parse.
+    interpreter::config::install(make_zone_config());
+    global_args.parse("take every.pen", false);
+    if (!global_args[1].has_prefix_all()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/// @file test_keyword_index.cpp
+/// @brief Test the resolution of the arguments to the objects of a container.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/keyword_index.hpp>
+
+int main()
+{
+    interpreter::KeywordIndex room;
+    // Objects 10, 11, 12 and 13, in the order they entered the room.
+    room.insert("Pen", 10);
+    room.insert("red", 11);
+    room.insert("PENCIL", 11);
+    room.insert("pen", 12);
+    room.insert("box", 13);
+    room.insert("Penny", 13);
+
+    std::vector<std::uint32_t> found;
+    interpreter::Interpreter args;
+
+    // The first match, then the Nth one.
+    args.parse("get pe 2.pen 3.pen 4.pen", false);
+    if ((room.find(args[1], found) != 1) || (found[0] != 10) || (room.find(args[2], found) != 1) ||
+        (found[0] != 11) || (room.find(args[3], found) != 1) || (found[0] != 12) || (room.find(args[4], found) != 1) ||
+        (found[0] != 13)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // A quantity, starting from the first match or from an index.
+    args.parse("get 5*PEN 2*2.pen all.pen 5.pen", false);
+    if ((room.find(args[1], found) != 4) || (found[0] != 10) || (found[1] != 11) ||
+        (room.find(args[2], found) != 2) || (found[0] != 11) || (found[1] != 12) || (room.find(args[3], found) != 4) ||
+        (found[2] != 12) || (found[3] != 13) || (room.find(args[4], found) != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Objects matching more than one keyword are counted once.
+    args.parse("get all.r all.x", false);
+    if ((room.find(args[1], found) != 1) || (found[0] != 11) || (room.find(args[2], found) != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Removed keywords no longer match.
+    if (!room.erase("PEN", 10) || room.erase("pen", 10) || (room.size() != 5)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("get all.pen", false);
+    if ((room.find(args[1], found) != 3) || (found[0] != 11) || (found[1] != 12)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Objects registered twice are matched once, with one keyword or several.
+    interpreter::KeywordIndex bag;
+    bag.insert("coin", 1);
+    bag.insert("coin", 2);
+    bag.insert("COIN", 1);
+    if ((bag.size() != 2) || (bag.find("coin", 1, std::string::npos, found) != 2) || (found[1] != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    bag.insert("coins", 2);
+    bag.insert("cog", 3);
+    if ((bag.find("co", 1, std::string::npos, found) != 3) || (found[0] != 1) || (found[1] != 2) ||
+        (found[2] != 3) || (bag.find("co", 2, 1, found) != 1) || (found[0] != 2) ||
+        (bag.find("co", 4, 1, found) != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Crowded containers.
+    interpreter::KeywordIndex vault;
+    for (std::uint32_t object = 0; object < 20000; ++object) {
+        vault.insert((object % 2) == 0 ? "coin" : "gem", object);
+    }
+    if ((vault.find("co", 5000, 3, found) != 3) || (found[0] != 9998) || (found[2] != 10002) ||
+        (vault.find("gem", 1, std::string::npos, found) != 10000)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/// @file test_keyword_table.cpp
+/// @brief Test that matching a table of keywords agrees with Argument::is_abbreviation_of().
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/keyword_table.hpp>
+
+#include <random>
+
+/// @brief Compares a table of random keywords with Argument::is_abbreviation_of(), using one implementation.
+static inline bool check(const char *implementation)
+{
+    if (!interpreter::KeywordTable::set_implementation(implementation)) {
+        // Not supported by this processor.
+        return true;
+    }
+    // Short and long keywords, spanning several blocks.
+    const char alphabet[] = "aAbB";
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> length(0, 20);
+    std::uniform_int_distribution<std::size_t> character(0, sizeof(alphabet) - 2);
+    auto random_word = [&]() {
+        std::string word(length(generator), ' ');
+        for (auto &c : word) {
+            c = alphabet[character(generator)];
+        }
+        return word;
+    };
+    std::vector<std::string> keywords(100);
+    for (auto &keyword : keywords) {
+        keyword = random_word();
+    }
+    keywords[7] = std::string(20, 'a');
+    keywords[8] = std::string(16, 'a');
+    keywords[9] = std::string(80, 'a');
+    interpreter::KeywordTable table(keywords);
+
+    std::vector<std::uint32_t> found;
+    for (int test = 0; test < 2000; ++test) {
+        std::string word = random_word();
+        if (test < 40) {
+            word = std::string(static_cast<std::size_t>(test % 20) + 1, (test < 20) ? 'a' : 'A');
+        } else if (test < 50) {
+            // Longer than the words folded on the stack.
+            word = std::string(static_cast<std::size_t>(test + 20), 'A');
+        }
+        interpreter::Argument argument(word);
+        for (bool sensitive : {false, true}) {
+            for (std::size_t min_length : {std::size_t(1), std::size_t(3)}) {
+                table.match(argument, found, sensitive, min_length);
+                std::vector<std::uint32_t> expected;
+                for (std::uint32_t position = 0; position < keywords.size(); ++position) {
+                    if (argument.is_abbreviation_of(keywords[position], sensitive, min_length)) {
+                        expected.push_back(position);
+                    }
+                }
+                if (found != expected) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    for (const char *implementation : {"scalar", "sse2", "avx2"}) {
+        if (!check(implementation)) {
+            std::cerr << "Test failed! Implementation: " << implementation << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<std::uint32_t> found;
+
+    // Words containing '\0' do not match the padding.
+    interpreter::KeywordTable names(std::vector<std::string>{"sword", "shield", std::string("ab\0c", 4)});
+    if ((names.match(std::string_view("ab\0", 3), found) != 1) || (found[0] != 2) ||
+        (names.match(std::string_view("sw\0", 3), found) != 0) || (names.match("S", found) != 2) ||
+        (names.get_keyword(1) != "shield")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+/// @file test_lazy_prefix.cpp
+/// @brief Test that the prefixes evaluated on demand give the same results, whatever is accessed first.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    interpreter::Interpreter args;
+
+    // Copying back the words does not need their prefixes.
+    args.parse("say meet me at 2.gate, bring 3*rope. all.of.you!", false);
+    if (args.substr(1) != "meet me at 2.gate, bring 3*rope. all.of.you!") {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The prefixes are the same, whichever accessor comes first.
+    args.parse("take 2*3.pen", false);
+    if ((args[1].get_index() != 3) || (args[1].get_content_view() != "pen") || (args[1].get_quantity() != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("take 2*3.pen", false);
+    if (!args[1].has_quantity() || !args[1].has_index() || (args[1].length() != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Copies of an argument which was not evaluated yet evaluate on their own.
+    args.parse("take all.pen", false);
+    interpreter::Argument copy(args[1]);
+    if (!copy.has_prefix_all() || (copy.get_content_view() != "pen") || !args[1].has_prefix_all()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Forcing values, or modifying the text, evaluates the prefixes first.
+    args.parse("take 4.pen 5*coin 6.box", false);
+    args[1].set_index(7);
+    args[2].set_content("gold");
+    args[3][0] = 'B';
+    if ((args[1].get_index() != 7) || (args[1].get_content_view() != "pen") || (args[2].get_quantity() != 5) ||
+        (args[2].get_content_view() != "gold") || (args[3].get_content_view() != "Box") ||
+        (args[3].get_index() != 6)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Ignored words are recognized by their content.
+    args.parse("look at 2.the 3.box", false);
+    args.remove_ignored_words();
+    if ((args.size() != 2) || (args[1].get_content_view() != "box") || (args[1].get_index() != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/// @file test_line_assembler.cpp
+/// @brief Test the assembly of the lines received by a session.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/line_assembler.hpp>
+
+#include <cstring>
+
+int main()
+{
+    interpreter::LineAssembler assembler;
+    std::vector<std::string_view> lines;
+
+    // Several lines from a single read, read straight into the buffer.
+    const char input[] = "look\r\nsay hi\r\nkill";
+    char *destination  = assembler.prepare();
+    std::memcpy(destination, input, sizeof(input) - 1);
+    assembler.commit(sizeof(input) - 1);
+    if ((assembler.next_lines(lines) != 2) || (lines[0] != "look") || (lines[1] != "say hi") ||
+        (lines[0].data() != destination) || (assembler.size() != 4)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Telnet commands and backspaces, split between reads, one byte at a time.
+    const std::string telnet = " r\xff\xfb\x01x\bat\xff\xfa\x18\x01\xff\xff\xff\xf0\r\n\xff\xff\n";
+    for (char c : telnet) {
+        assembler.append(std::string_view(&c, 1));
+    }
+    if ((assembler.next_lines(lines) != 2) || (lines[0] != "kill rat") || (lines[1] != "\xff")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // A backspace cannot remove the end of the previous line.
+    assembler.append("n\n\b\bs\n");
+    if ((assembler.next_lines(lines) != 2) || (lines[0] != "n") || (lines[1] != "s")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The backspaces can erase the bytes already searched for the end of the line.
+    assembler.clear();
+    for (char c : std::string_view("abc")) {
+        assembler.append(std::string_view(&c, 1));
+    }
+    std::string_view line;
+    if (assembler.next_line(line)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (char c : std::string_view("\b\bx\n")) {
+        assembler.append(std::string_view(&c, 1));
+    }
+    if ((assembler.next_lines(lines) != 1) || (lines[0] != "ax")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (char c : std::string_view("abcd")) {
+        assembler.append(std::string_view(&c, 1));
+    }
+    if (assembler.next_line(line)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (char c : std::string_view("\b\b\b")) {
+        assembler.append(std::string_view(&c, 1));
+        if (assembler.next_line(line)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    assembler.append("e\n");
+    if (!assembler.next_line(line) || (line != "ae") || (assembler.size() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Lines longer than the buffer are handed out in pieces.
+    interpreter::LineAssembler small(8);
+    std::string_view rest = "abcdefghij\nk\n";
+    rest.remove_prefix(small.append(rest));
+    if ((small.next_lines(lines) != 1) || (lines[0] != "abcdefgh") || (small.append(rest) != 5) ||
+        (small.next_lines(lines) != 2) || (lines[0] != "ij") || (lines[1] != "k") || (small.size() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The lines of a read can be parsed together.
+    assembler.clear();
+    assembler.append("get 2.pen\r\n\xff\xfd\x03north\r\ndrop all.coin\r\n");
+    interpreter::ParseBatch batch;
+    batch.parse(lines.data(), assembler.next_lines(lines), false);
+    if ((batch.size() != 3) || (batch.get_word_count() != 5) || (batch.get_index(1) != 2) ||
+        (batch.get_line(1) != "north") || !batch.has_prefix_all(4)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/// @file test_number_prefix.cpp
+/// @brief Test the numbers of the prefixes, at the bounds and when they overflow.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    interpreter::Interpreter args;
+
+    // The largest accepted number is right below INT_MAX.
+    args.parse("take 2147483646.pen 2147483646*coin", false);
+    if (!args[1].has_index() || (args[1].get_index() != 2147483646) || !args[2].has_quantity() ||
+        (args[2].get_quantity() != 2147483646)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Larger numbers, even those which do not fit any integer, are dropped with their prefix.
+    args.parse("take 2147483647.pen 99999999999999999999999*coin", false);
+    if (args[1].has_index() || (args[1].get_index() != 1) || (args[1].get_content_view() != "pen") ||
+        args[2].has_quantity() || (args[2].get_quantity() != 1) || (args[2].get_content_view() != "coin")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Numbers alone, and digits followed by something else, are not prefixes.
+    args.parse("give 12 a2.pen 3x.coin", false);
+    if (args[1].has_index() || (args[1].get_content_view() != "12") || args[2].has_index() ||
+        (args[2].get_content_view() != "a2.pen") || args[3].has_index() ||
+        (args[3].get_content_view() != "3x.coin")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The numbers can have a sign, the negative ones are dropped with their prefix.
+    args.parse("take +5.sword -5.sword +7 -.pen +*coin", false);
+    if (!args[1].has_index() || (args[1].get_index() != 5) || (args[1].get_content_view() != "sword") ||
+        args[2].has_index() || (args[2].get_index() != 1) || (args[2].get_content_view() != "sword") ||
+        (args[3].get_content_view() != "+7") || args[4].has_index() || (args[4].get_content_view() != "-.pen") ||
+        args[5].has_quantity() || (args[5].get_content_view() != "+*coin")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Both prefixes, in either order.
+    args.parse("take 3*2.pen 4.5*coin", false);
+    if ((args[1].get_quantity() != 3) || (args[1].get_index() != 2) || (args[1].get_content_view() != "pen") ||
+        (args[2].get_index() != 4) || (args[2].get_quantity() != 5) || (args[2].get_content_view() != "coin")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The same rules apply to the batches.
+    interpreter::ParseBatch batch;
+    batch.parse(std::vector<std::string>{"take 99999999999999999999999.pen 7*coin +3.box"}, false);
+    if (batch.has_index(1) || (batch.get_content_view(1) != "pen") || !batch.has_quantity(2) ||
+        (batch.get_quantity(2) != 7) || !batch.has_index(3) || (batch.get_index(3) != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/// @file test_option_set.cpp
+/// @brief Test that the compiled option sets agree with the predicate-based mapping.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+enum option_type_t {
+    option_type_none,
+    option_type_name,
+    option_type_address,
+    option_type_color,
+};
+
+int main()
+{
+    static constexpr interpreter::OptionName option_names[] = {
+        {option_type_name, "name"},
+        {option_type_address, "address"},
+        {option_type_color, "color"},
+        {option_type_color, "colour"},
+    };
+    const interpreter::OptionSet from_table(option_names, 3);
+    const std::vector<interpreter::Option> option_list = {
+        {option_type_name, {"name"}},
+        {option_type_address, {"address"}},
+        {option_type_color, {"color", "colour"}},
+    };
+    const interpreter::OptionSet from_list(option_list, 3);
+
+    for (const char *word : {"name", "NAM", "na", "names", "addr", "ADDRESS", "col", "colou", "colour", "x", ""}) {
+        interpreter::Argument argument(word);
+        unsigned expected = argument.map_to_option(option_list, [](const std::string &content, const std::string &name) {
+            return ustr::is_abbreviation_of(content, name, false, 3);
+        });
+        if ((argument.map_to_option(from_table) != expected) || (argument.map_to_option(from_list) != expected)) {
+            std::cerr << "Test failed! Word: " << word << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/// @file test_parse_batch.cpp
+/// @brief Test that parsing a batch of lines matches parsing them one at a time.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    std::vector<std::string> lines = {
+        "take 2*pen from 3.box", "", "   ", "look at the all.sword", "say hello\tthere", "put 2.5*coin in the bag"};
+
+    interpreter::ParseBatch batch;
+    batch.parse(lines, true);
+
+    if (batch.size() != lines.size()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    std::size_t total = 0;
+    for (std::size_t line = 0; line < lines.size(); ++line) {
+        interpreter::Interpreter single;
+        single.parse(lines[line].c_str(), true);
+        if ((batch.get_line(line) != lines[line]) || (batch.get_word_count(line) != single.size()) ||
+            (batch.get_first_word(line) != total)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        for (std::size_t it = 0; it < single.size(); ++it) {
+            std::size_t word = batch.get_first_word(line) + it;
+            if ((batch.get_original_view(word) != single[it].get_original_view()) ||
+                (batch.get_content_view(word) != single[it].get_content_view()) ||
+                (batch.get_index(word) != single[it].get_index()) ||
+                (batch.get_quantity(word) != single[it].get_quantity()) ||
+                (batch.has_index(word) != single[it].has_index()) ||
+                (batch.has_quantity(word) != single[it].has_quantity()) ||
+                (batch.has_prefix_all(word) != single[it].has_prefix_all())) {
+                std::cerr << "Test failed!" << std::endl;
+                return 1;
+            }
+        }
+        // Loading the line from the batch must give the same arguments.
+        interpreter::Interpreter loaded;
+        loaded.parse(batch, line);
+        if ((loaded.get_original_view() != lines[line]) || (loaded.size() != single.size())) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        for (std::size_t it = 0; it < single.size(); ++it) {
+            if ((loaded[it].get_original_view() != single[it].get_original_view()) ||
+                (loaded[it].get_content_view() != single[it].get_content_view()) ||
+                (loaded[it].get_index() != single[it].get_index()) ||
+                (loaded[it].get_quantity() != single[it].get_quantity())) {
+                std::cerr << "Test failed!" << std::endl;
+                return 1;
+            }
+        }
+        total += single.size();
+    }
+    if (batch.get_word_count() != total) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // An empty batch has no lines.
+    batch.parse(nullptr, 0, true);
+    if ((batch.size() != 0) || (batch.get_word_count() != 0)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
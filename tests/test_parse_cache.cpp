@@ -0,0 +1,107 @@
+/// @file test_parse_cache.cpp
+/// @brief Test that the lines loaded from the cache are the same as the parsed ones.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/parse_cache.hpp>
+
+#include <atomic>
+#include <thread>
+
+/// @brief Checks that two interpreters hold the same arguments.
+static inline bool same(const interpreter::Interpreter &lhs, const interpreter::Interpreter &rhs)
+{
+    if ((lhs.size() != rhs.size()) || (lhs.get_original_view() != rhs.get_original_view())) {
+        return false;
+    }
+    for (std::size_t it = 0; it < lhs.size(); ++it) {
+        if ((lhs[it].get_original_view() != rhs[it].get_original_view()) ||
+            (lhs[it].get_content_view() != rhs[it].get_content_view()) ||
+            (lhs[it].get_index() != rhs[it].get_index()) || (lhs[it].get_quantity() != rhs[it].get_quantity()) ||
+            (lhs[it].has_prefix_all() != rhs[it].has_prefix_all()) ||
+            (lhs[it].has_index() != rhs[it].has_index()) || (lhs[it].has_quantity() != rhs[it].has_quantity())) {
+            return false;
+        }
+    }
+    return lhs.substr(0) == rhs.substr(0);
+}
+
+int main()
+{
+    const std::vector<std::string> lines = {
+        "n", "look", "kill rat", "get all.corpse", "take 2*3.Pen from the box", "  say   hello there  ", "",
+    };
+    interpreter::ParseCache cache(64, 4);
+    interpreter::Interpreter cached;
+    interpreter::Interpreter parsed;
+
+    // The first time the lines are parsed, then they are loaded.
+    for (int round = 0; round < 3; ++round) {
+        for (const auto &line : lines) {
+            for (bool ignore : {false, true}) {
+                bool hit = cache.parse(cached, line, ignore);
+                parsed.parse(line, ignore);
+                bool has_pen = (cached.find("PEN") != nullptr);
+                if ((hit != (round > 0)) || !same(cached, parsed) || (has_pen != (line[0] == 't'))) {
+                    std::cerr << "Test failed!" << std::endl;
+                    return 1;
+                }
+            }
+        }
+    }
+    if ((cache.get_misses() != 14) || (cache.get_hits() != 28) || (cache.size() != 14)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Installing another configuration parses the lines again.
+    interpreter::config::install(std::make_shared<const interpreter::Config>(
+        std::vector<std::string>{"all", "every"}, std::vector<std::string>{"from"}, "*", ".#"));
+    if (cache.parse(cached, "get every.corpse", false) || cache.parse(cached, "get all.corpse", false) ||
+        !cached[1].has_prefix_all() || !cache.parse(cached, "get all.corpse", false)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    interpreter::config::update();
+
+    // Only the lines used recently survive the eviction.
+    interpreter::ParseCache small(4, 1);
+    for (const char *line : {"a", "b", "c", "d"}) {
+        small.parse(cached, line, false);
+    }
+    small.parse(cached, "a", false);
+    small.parse(cached, "e", false);
+    if ((small.size() != 4) || !small.parse(cached, "a", false) || small.parse(cached, "b", false)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Several threads can share the cache.
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; ++worker) {
+        workers.emplace_back([&cache, &lines, &failed]() {
+            interpreter::Interpreter local;
+            interpreter::Interpreter reference;
+            for (int it = 0; it < 2000; ++it) {
+                const std::string &line = lines[static_cast<std::size_t>(it) % lines.size()];
+                cache.parse(local, line, true);
+                reference.parse(line, true);
+                if (!same(local, reference)) {
+                    failed.store(true);
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (failed.load()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/// @file test_pipeline.cpp
+/// @brief Test that the pipeline parses the lines like a single interpreter, and in the same order.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/pipeline.hpp>
+
+int main()
+{
+    const std::vector<std::string> commands = {
+        "take 2*pen from 3.box", "look", "say hello to everyone in the room", "put all.coin in the bag", "", "   "};
+
+    // Build a tick with lines of very different lengths, so that the workers steal from each other.
+    std::vector<std::string> lines;
+    for (std::size_t it = 0; it < 1000; ++it) {
+        lines.push_back(commands[it % commands.size()]);
+        if ((it % 97) == 0) {
+            lines.back().append(std::string(2000, 'x'));
+        }
+    }
+
+    interpreter::Pipeline pipeline(4);
+    std::vector<interpreter::Interpreter> results;
+    // Parse a few ticks, the results are reused from one tick to the next.
+    for (std::size_t tick = 0; tick < 3; ++tick) {
+        pipeline.parse(lines, true, results);
+        if ((pipeline.size() != 4) || (results.size() != lines.size())) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        for (std::size_t it = 0; it < lines.size(); ++it) {
+            interpreter::Interpreter expected;
+            expected.parse(lines[it].c_str(), true);
+            if ((results[it].get_original_view() != lines[it]) || (results[it].size() != expected.size())) {
+                std::cerr << "Test failed!" << std::endl;
+                return 1;
+            }
+            for (std::size_t arg = 0; arg < expected.size(); ++arg) {
+                if ((results[it][arg].get_content_view() != expected[arg].get_content_view()) ||
+                    (results[it][arg].get_index() != expected[arg].get_index()) ||
+                    (results[it][arg].get_quantity() != expected[arg].get_quantity())) {
+                    std::cerr << "Test failed!" << std::endl;
+                    return 1;
+                }
+            }
+        }
+    }
+
+    // The results keep following the global configuration, and those given their own one keep it.
+    {
+        std::vector<std::string> tick = {"take every.pen", "take every.pen"};
+        auto zone = std::make_shared<const interpreter::Config>(
+            std::vector<std::string>{"all", "every"}, std::vector<std::string>{}, "*", ".");
+        pipeline.parse(tick, false, results);
+        results[1].set_config(zone);
+        pipeline.parse(tick, false, results);
+        if (results[0][1].has_prefix_all() || !results[1][1].has_prefix_all()) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        interpreter::config::install(zone);
+        results[0].parse("take every.pen", false);
+        interpreter::config::update();
+        results[1].parse("take every.pen", false);
+        if (!results[0][1].has_prefix_all() || !results[1][1].has_prefix_all()) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+
+    // An empty tick gives no results.
+    pipeline.parse(std::vector<std::string>(), true, results);
+    if (!results.empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Out of range arguments are empty, and modifying them does not affect the next ones.
+    interpreter::Interpreter args;
+    args.parse("look", false);
+    args[3].set_content("modified");
+    if (!args[3].get_content_view().empty() || !args[4].get_original_view().empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/// @file test_pop_front.cpp
+/// @brief Test removing the first arguments, and the ignored words.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    interpreter::Interpreter args;
+    args.parse("put the 2*coin in the 3.bag on the table", false);
+
+    // Removing the head keeps the other arguments in place.
+    args.erase(0);
+    if ((args.size() != 8) || (args[0].get_content_view() != "the") || (args.begin()->get_content_view() != "the")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.pop_front();
+    if ((args[0].get_content_view() != "coin") || (args[0].get_quantity() != 2) || (args.get(0).get_quantity() != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The ignored words are removed in a single pass, keeping the order.
+    args.remove_ignored_words();
+    if ((args.size() != 3) || (args[0].get_content_view() != "coin") || (args[1].get_content_view() != "bag") ||
+        (args[1].get_index() != 3) || (args[2].get_content_view() != "table") ||
+        (args.substr(0) != "2*coin 3.bag table") || !args.substr_view(0).empty() || (args.substr_view(2) != "table")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Erasing in the middle still works, and consuming stops at the end.
+    args.erase(1);
+    if ((args.size() != 2) || (args[1].get_content_view() != "table")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.consume(5);
+    if (!args.empty() || (args.size() != 0) || (args.begin() != args.end()) || !args[0].empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Copies keep the arguments which were removed out, and parsing starts over.
+    args.parse("take 2.pen from box", true);
+    args.consume(1);
+    interpreter::Interpreter copy(args);
+    args.parse("look", true);
+    if ((copy.size() != 2) || (copy[0].get_content_view() != "pen") || (args.size() != 1) ||
+        (args[0].get_content_view() != "look")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/// @file test_raw_passthrough.cpp
+/// @brief Test that free-text commands get the rest of the line as it was typed.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/command_table.hpp>
+
+int main()
+{
+    interpreter::Interpreter args;
+
+    // Only the first arguments are parsed, the rest keeps its spacing.
+    args.parse("tell  bob   meet me   at 2.gate \r\n", true, 2);
+    if ((args.size() != 2) || (args[1].get_content_view() != "bob") || (args.get_rest() != "meet me   at 2.gate")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Without a limit, or with a limit past the end, there is no rest.
+    args.parse("take 2*pen", true);
+    if ((args.size() != 2) || !args.get_rest().empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("take 2*pen   ", true, 5);
+    if ((args.size() != 2) || !args.get_rest().empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Ignored words do not count towards the limit.
+    args.parse("look at the  red  box", true, 2);
+    if ((args.size() != 2) || (args[1].get_content_view() != "red") || (args.get_rest() != "box")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Parsing can continue from the rest, with the same positions.
+    args.parse("tell  bob   meet me   at 2.gate", true, 1);
+    args.parse_rest(true, 2);
+    if ((args.size() != 2) || (args[1].get_content_view() != "bob") || (args.get_rest() != "meet me   at 2.gate") ||
+        (args.substr_view(0) != "tell  bob")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse_rest(true);
+    if ((args.size() != 5) || (args[4].get_content_view() != "gate") || (args[4].get_index() != 2) ||
+        !args.get_rest().empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The dispatcher only parses the arguments the command needs.
+    std::string said;
+    std::size_t taken = 0;
+    interpreter::CommandTable commands;
+    commands.add(
+        "say",
+        [&said](interpreter::Interpreter &a) {
+            said = std::string(a.get_rest());
+            return a.empty();
+        },
+        std::string::npos, 0, 0);
+    commands.add("take", [&taken](interpreter::Interpreter &a) {
+        taken = a.size();
+        return a.get_rest().empty();
+    });
+    if (!commands.dispatch(args, "say   hello,   world!  ", false) || (said != "hello,   world!")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if (!commands.dispatch(args, "say", false) || !said.empty()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if (!commands.dispatch(args, "take 2*pen from the box", true) || (taken != 2)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    std::string told;
+    commands.add(
+        "tell",
+        [&told](interpreter::Interpreter &a) {
+            told = std::string(a[0].get_content_view()) + ":" + std::string(a.get_rest());
+            return a.size() == 1;
+        },
+        std::string::npos, 0, 1);
+    if (!commands.dispatch(args, "tell  Bob   meet me   at 2.gate", true) || (told != "Bob:meet me   at 2.gate")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if (commands.dispatch(args, "dance with me", false)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
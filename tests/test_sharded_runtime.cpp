@@ -0,0 +1,206 @@
+/// @file test_sharded_runtime.cpp
+/// @brief Test that the shards execute their own sessions, and exchange the messages in order.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/sharded_runtime.hpp>
+
+#include <atomic>
+#include <chrono>
+
+/// @brief A message received by a session.
+struct Received {
+    std::uint32_t session; ///< The session.
+    std::string text;      ///< The text.
+};
+
+int main()
+{
+    // The queue keeps the order, and refuses the values when it is full.
+    interpreter::SpscQueue<int> small(3);
+    if (small.capacity() != 4) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (int it = 0; it < 4; ++it) {
+        if (!small.try_push(int(it))) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    int value = 0;
+    if (small.try_push(4) || (small.size() != 4) || !small.try_pop(value) || (value != 0) || !small.try_push(4)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (int it = 1; it <= 4; ++it) {
+        if (!small.try_pop(value) || (value != it)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    if (small.try_pop(value)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The values cross from one thread to the other in order.
+    interpreter::SpscQueue<std::string> strings(16);
+    const int count = 100000;
+    std::thread producer([&strings]() {
+        for (int it = 0; it < count; ++it) {
+            std::string text = std::to_string(it);
+            while (!strings.try_push(std::move(text))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::string text;
+    for (int it = 0; it < count; ++it) {
+        while (!strings.try_pop(text)) {
+            std::this_thread::yield();
+        }
+        if (text != std::to_string(it)) {
+            producer.join();
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    producer.join();
+
+    // Every session tells something to every other session, through tiny
+    // queues, so that most messages must wait inside the sending shard.
+    const std::size_t shards   = 4;
+    const std::uint32_t people = 12;
+    std::vector<std::vector<std::string>> scripts(people);
+    for (std::uint32_t from = 0; from < people; ++from) {
+        scripts[from].push_back("look");
+        for (std::uint32_t to = 0; to < people; ++to) {
+            for (int round = 0; round < 20; ++round) {
+                scripts[from].push_back(
+                    "tell " + std::to_string(to) + " " + std::to_string(from) + ":" + std::to_string(round));
+            }
+        }
+        scripts[from].push_back("dance");
+    }
+    // Each shard touches only its own slot.
+    std::vector<std::vector<Received>> inboxes(shards);
+    std::vector<std::size_t> cursors(shards, 0);
+    std::vector<int> refused(shards, 0);
+    std::vector<int> foreign(shards, 0);
+
+    interpreter::ShardedRuntime runtime(
+        shards,
+        [&refused, &foreign](
+            interpreter::ShardedRuntime::Shard &shard, std::uint32_t session, interpreter::Interpreter &args) {
+            if ((session % shards) != shard.get_index()) {
+                ++foreign[shard.get_index()];
+            }
+            if (args[0] == "tell") {
+                shard.send(static_cast<std::uint32_t>(std::stoul(args[1].get_content())), args.substr(2));
+                return true;
+            }
+            if (args[0] == "look") {
+                return true;
+            }
+            ++refused[shard.get_index()];
+            return false;
+        },
+        [&inboxes](interpreter::ShardedRuntime::Shard &shard, std::uint32_t session, std::string_view message) {
+            inboxes[shard.get_index()].push_back(Received{session, std::string(message)});
+        },
+        [&scripts, &cursors](interpreter::ShardedRuntime::Shard &shard) {
+            // Execute one line of every session of the shard.
+            std::size_t &cursor = cursors[shard.get_index()];
+            bool busy           = false;
+            for (std::uint32_t session = static_cast<std::uint32_t>(shard.get_index()); session < people;
+                 session += static_cast<std::uint32_t>(shards)) {
+                if (cursor < scripts[session].size()) {
+                    shard.execute(session, scripts[session][cursor]);
+                    busy = true;
+                }
+            }
+            ++cursor;
+            return busy;
+        },
+        2);
+
+    const std::uint64_t expected = people * people * 20;
+    auto deadline                = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while ((runtime.get_received() < expected) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    runtime.stop();
+    if ((runtime.get_received() != expected) || (runtime.get_executed() != people * ((people * 20) + 2))) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Every message reached the shard of its session, and the messages from
+    // one session to another arrived in the order they were sent.
+    for (std::size_t shard = 0; shard < shards; ++shard) {
+        if ((refused[shard] != 3) || (foreign[shard] != 0)) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        std::vector<std::vector<int>> next(people, std::vector<int>(people, 0));
+        for (const Received &received : inboxes[shard]) {
+            std::size_t colon = received.text.find(':');
+            auto from         = static_cast<std::uint32_t>(std::stoul(received.text.substr(0, colon)));
+            int round         = std::stoi(received.text.substr(colon + 1));
+            if (((received.session % shards) != shard) || (round != next[received.session][from]++)) {
+                std::cerr << "Test failed!" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // The messages still travelling when the runtime stops are delivered, even
+    // those waiting inside a shard which stopped before it could send them.
+    {
+        std::atomic<bool> sent(false), release(false);
+        std::vector<std::string> delivered;
+        interpreter::ShardedRuntime stopping(
+            2, [](interpreter::ShardedRuntime::Shard &, std::uint32_t, interpreter::Interpreter &) { return true; },
+            [&delivered](interpreter::ShardedRuntime::Shard &, std::uint32_t, std::string_view message) {
+                delivered.emplace_back(message);
+            },
+            [&sent, &release](interpreter::ShardedRuntime::Shard &shard) {
+                if (shard.get_index() == 1) {
+                    // The receiving shard is busy until the runtime is stopping.
+                    while (!release.load()) {
+                        std::this_thread::yield();
+                    }
+                } else if (!sent.load()) {
+                    for (int it = 0; it < 50; ++it) {
+                        shard.send(1, std::to_string(it));
+                    }
+                    sent.store(true);
+                }
+                return false;
+            },
+            2);
+        while (!sent.load()) {
+            std::this_thread::yield();
+        }
+        std::thread releaser([&release]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            release.store(true);
+        });
+        stopping.stop();
+        releaser.join();
+        if (delivered.size() != 50) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+        for (std::size_t it = 0; it < delivered.size(); ++it) {
+            if (delivered[it] != std::to_string(it)) {
+                std::cerr << "Test failed!" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/// @file test_substr_view.cpp
+/// @brief Test that substr returns the input as it was typed, between two arguments.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+int main()
+{
+    interpreter::Interpreter args;
+    args.parse("emote  waves   at 2.guard  ", false);
+
+    std::string_view view = args.substr_view(1);
+    std::string_view original = args.get_original_view();
+    if ((view != "waves   at 2.guard") || (view.data() < original.data()) ||
+        ((view.data() + view.size()) > (original.data() + original.size()))) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if ((args.substr_view(1, 2) != "waves") || (args.substr_view(2, 100) != "at 2.guard") ||
+        (args.substr(1) != "waves at 2.guard")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Empty, or out of range, ranges give an empty text.
+    if (!args.substr_view(4).empty() || !args.substr_view(2, 2).empty() || (args.substr(7) != args.get_original())) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Removing the first argument, or changing one, does not move the others.
+    args.erase(0);
+    args[2].set_content("captain");
+    if (args.substr_view(0) != "waves   at 2.guard") {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // The arguments missing from the input, or replaced, leave a gap the view cannot cover.
+    args.parse("put the coin in the bag", true);
+    if (!args.substr_view(0).empty() || (args.substr_view(1, 2) != "coin") || (args.substr(0) != "put coin bag")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.parse("emote waves at the guard", false);
+    args[1] = interpreter::Argument("nods");
+    if (!args.substr_view(0).empty() || (args.substr_view(2) != "at the guard") ||
+        (args.substr(0, 3) != "emote nods at ")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    args.erase(3);
+    if (!args.substr_view(2).empty() || (args.substr_view(3) != "guard") || (args.substr(2) != "at guard")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Copies refer to their own input.
+    args.parse("emote  waves   at 2.guard  ", false);
+    args.erase(0);
+    interpreter::Interpreter copy(args);
+    args.parse("say something else", false);
+    if (copy.substr_view(1) != "at 2.guard") {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/// @file test_tokenizer.cpp
+/// @brief Test that every tokenizer implementation agrees with a simple reference.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <random>
+
+/// @brief Splits the text one character at a time.
+static inline std::vector<interpreter::Token> reference(const std::string &text)
+{
+    std::vector<interpreter::Token> tokens;
+    std::size_t it = 0;
+    while (it < text.length()) {
+        if (std::string(" \t\r\n\v\f").find(text[it]) != std::string::npos) {
+            ++it;
+            continue;
+        }
+        std::size_t end = text.find_first_of(" \t\r\n\v\f", it);
+        if (end == std::string::npos) {
+            end = text.length();
+        }
+        std::string word = text.substr(it, end - it);
+        tokens.push_back(interpreter::Token{it, end - it, word.find_first_of("."), word.find_first_of("*")});
+        it = end;
+    }
+    return tokens;
+}
+
+/// @brief Checks the tokenizer against the reference on random texts.
+static inline bool check(const char *implementation)
+{
+    if (!interpreter::Tokenizer::set_implementation(implementation)) {
+        // Not supported by this processor.
+        return true;
+    }
+    const char alphabet[] = "ab .*\t\r\n  2";
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> length(0, 300);
+    std::uniform_int_distribution<std::size_t> character(0, sizeof(alphabet) - 2);
+    interpreter::Tokenizer tokenizer(".", "*");
+    for (int test = 0; test < 2000; ++test) {
+        std::string text(length(generator), ' ');
+        for (auto &c : text) {
+            c = alphabet[character(generator)];
+        }
+        std::vector<interpreter::Token> tokens;
+        tokenizer.tokenize(text, [&tokens](const interpreter::Token &token) { tokens.push_back(token); });
+        std::vector<interpreter::Token> expected = reference(text);
+        if (tokens.size() != expected.size()) {
+            return false;
+        }
+        for (std::size_t it = 0; it < tokens.size(); ++it) {
+            if ((tokens[it].begin != expected[it].begin) || (tokens[it].length != expected[it].length) ||
+                (tokens[it].index_pos != expected[it].index_pos) ||
+                (tokens[it].quantity_pos != expected[it].quantity_pos)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    for (const char *implementation : {"scalar", "sse2", "avx2"}) {
+        if (!check(implementation)) {
+            std::cerr << "Test failed! Implementation: " << implementation << std::endl;
+            return 1;
+        }
+    }
+
+    // Telnet input can contain tabs, carriage returns and runs of spaces.
+    interpreter::Interpreter args;
+    args.parse("take\t2*pen   from\t 3.box\r\n", false);
+    if ((args.size() != 4) || (args[1].get_content_view() != "pen") || (args[1].get_quantity() != 2) ||
+        (args[3].get_content_view() != "box") || (args[3].get_index() != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
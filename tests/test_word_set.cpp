@@ -0,0 +1,76 @@
+/// @file test_word_set.cpp
+/// @brief Test the compiled lists of words used by the configuration.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+#include <interpreter/word_set.hpp>
+
+int main()
+{
+    // Every word of a large set must be found, in any case, and nothing else.
+    std::vector<std::string> words;
+    for (int it = 0; it < 500; ++it) {
+        words.push_back("word" + std::to_string(it));
+    }
+    interpreter::WordSet set(words);
+    for (const auto &word : words) {
+        std::string upper(word);
+        upper[0] = 'W';
+        if (!set.contains(word) || !set.contains(upper) || set.contains(word + "x") || set.contains(word + " ")) {
+            std::cerr << "Test failed! Word: " << word << std::endl;
+            return 1;
+        }
+    }
+    if (set.contains("") || set.contains("word500") || interpreter::WordSet().contains("word")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The default lists.
+    if (!interpreter::config::means_all("ALL") || !interpreter::config::must_ignore("From") ||
+        interpreter::config::must_ignore("fro") || interpreter::config::means_all("every")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // The changes to the lists are picked up, even when their size stays the same.
+    interpreter::config::list_of_all.push_back("every");
+    if (!interpreter::config::means_all("every")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    interpreter::config::list_of_all.back() = "each";
+    interpreter::Interpreter args;
+    args.parse("take each.pen", false);
+    if (!interpreter::config::means_all("each") || interpreter::config::means_all("every") ||
+        !args[1].has_prefix_all()) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Until a snapshot is installed on purpose, and again after an update.
+    interpreter::config::install(std::make_shared<const interpreter::Config>(
+        std::vector<std::string>{"every"}, std::vector<std::string>{}, "*", "."));
+    interpreter::config::list_of_all.back() = "any";
+    if (interpreter::config::means_all("any") || !interpreter::config::means_all("every")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    interpreter::config::update();
+    if (!interpreter::config::means_all("any") || interpreter::config::means_all("every")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    // Installing nothing goes back to the lists.
+    interpreter::config::install(std::make_shared<const interpreter::Config>(
+        std::vector<std::string>{"every"}, std::vector<std::string>{}, "*", "."));
+    interpreter::config::install(nullptr);
+    if (!interpreter::config::means_all("any") || interpreter::config::means_all("every")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
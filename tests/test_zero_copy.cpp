@@ -0,0 +1,73 @@
+/// @file test_zero_copy.cpp
+/// @brief Test that the arguments refer to the input line stored by the interpreter.
+/// Copyright (c) 2024-2025. All rights reserved.
+/// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include "test_common.hpp"
+
+/// @brief Checks that the view lies inside the original input of the interpreter.
+static inline bool is_inside(const interpreter::Interpreter &args, std::string_view view)
+{
+    std::string_view original = args.get_original_view();
+    return (view.data() >= original.data()) && ((view.data() + view.size()) <= (original.data() + original.size()));
+}
+
+int main()
+{
+    interpreter::Interpreter args;
+    args.parse("take  2*pen from 3.box", false);
+
+    if (args.size() != 4) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    if ((args[1].get_original_view() != "2*pen") || (args[1].get_content_view() != "pen") ||
+        (args[1].get_quantity() != 2) || (args[3].get_content_view() != "box") || (args[3].get_index() != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+    for (const auto &argument : args) {
+        if (!is_inside(args, argument.get_original_view()) || !is_inside(args, argument.get_content_view())) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+
+    // Copies and moves must refer to their own buffer.
+    interpreter::Interpreter copy(args);
+    interpreter::Interpreter moved(std::move(copy));
+    args.parse("say something else entirely", false);
+    if ((moved[3].get_content_view() != "box") || !is_inside(moved, moved[3].get_content_view())) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // A copy of a single argument takes its own text, and survives the next parse and the interpreter.
+    interpreter::Argument argument("");
+    {
+        interpreter::Interpreter scoped;
+        scoped.parse("take 2*pen from 3.box", false);
+        interpreter::Argument copy_of_pen(scoped[1]);
+        argument = scoped[3];
+        scoped.parse("say something else entirely, and longer than before", false);
+        if ((copy_of_pen.get_content_view() != "pen") || (copy_of_pen.get_quantity() != 2) ||
+            is_inside(scoped, copy_of_pen.get_original_view())) {
+            std::cerr << "Test failed!" << std::endl;
+            return 1;
+        }
+    }
+    if ((argument.get_original_view() != "3.box") || (argument.get_content_view() != "box") ||
+        (argument.get_index() != 3)) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    // Modifying the content must not modify the input.
+    moved[1][0] = 'P';
+    if ((moved[1].get_content_view() != "Pen") || (moved.get_original_view() != "take  2*pen from 3.box")) {
+        std::cerr << "Test failed!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}